@@ -85,7 +85,7 @@ void Analog_Sensors_Init(void)
 	ADC0->ACTSS |= 0x1;
 }
 
-void Sample_Analog_Sensors(double analog_value_buffer[])
+void Sample_Analog_Sensors_Raw(uint16_t sample_buffer[])
 {
 	// Begin sampling on the Sample Sequencer 0 module by setting the
 	// SS0 bit (Bit 0) in the PSSI register. Note that the SS0 bit 
@@ -100,13 +100,20 @@ void Sample_Analog_Sensors(double analog_value_buffer[])
 	// Read the conversion results for samples collected with the Sample Sequencer 0
 	// module by reading the SSFIFO0 (Sample Sequence Result FIFO 0) register
 	// The potentiometer will be sampled first and the light sensor will be sampled after
-	uint32_t potentiometer_sample_result = ADC0->SSFIFO0;
-	uint32_t light_sensor_sample_result = ADC0->SSFIFO0;
+	sample_buffer[0] = ADC0->SSFIFO0 & ANALOG_SENSORS_FULL_SCALE;
+	sample_buffer[1] = ADC0->SSFIFO0 & ANALOG_SENSORS_FULL_SCALE;
 	
 	// Clear the interrupt signal by setting the IN0 bit (Bit 0) in the ISC register.
 	ADC0->ISC |= 0x01;
+}
+
+void Sample_Analog_Sensors(double analog_value_buffer[])
+{
+	uint16_t sample_buffer[2];
+	
+	Sample_Analog_Sensors_Raw(sample_buffer);
 	
 	// Calculate the analog voltage measured and store the results in a double array
-	analog_value_buffer[0] = (potentiometer_sample_result * 3.3) / 4096;
-	analog_value_buffer[1] = (light_sensor_sample_result * 3.3) / 4096;
+	analog_value_buffer[0] = (sample_buffer[0] * 3.3) / 4096;
+	analog_value_buffer[1] = (sample_buffer[1] * 3.3) / 4096;
 }
@@ -21,6 +21,9 @@
 #include "TM4C123GH6PM.h"
 #include "SysTick_Delay.h"
 
+// Largest conversion result of the 12-bit ADC, which corresponds to 3.3 V
+#define ANALOG_SENSORS_FULL_SCALE   4095
+
 /**
  * @brief Initializes the potentiometer and the analog light sensor on the EduBase board.
  *
@@ -40,6 +43,19 @@
  */
 void Analog_Sensors_Init(void);
 
+/**
+ * @brief Stores the raw conversion results of the potentiometer and the analog light sensor in a buffer.
+ *
+ * This function samples the sensors like Sample_Analog_Sensors, but it stores the 12-bit conversion results
+ * (0 - ANALOG_SENSORS_FULL_SCALE) without converting them to voltages. It does not use floating-point
+ * arithmetic, so it is suited to sample the sensors at a high rate.
+ *
+ * @param sample_buffer An array of two elements to store the potentiometer and the light sensor results.
+ *
+ * @return None
+ */
+void Sample_Analog_Sensors_Raw(uint16_t sample_buffer[]);
+
 /**
  * @brief Stores the sampled results of the potentiometer and the analog light sensors in a buffer.
  *
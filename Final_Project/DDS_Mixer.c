@@ -0,0 +1,279 @@
+/**
+ * @file DDS_Mixer.c
+ *
+ * @brief Source code for the DDS_Mixer driver.
+ *
+ * This file contains the function definitions for the DDS_Mixer driver.
+ * It uses the Timer 2A module to generate the sample interrupts, and the Wide Timer 0A
+ * module in PWM mode to output the mix of the voices on the buzzer pin (PC4).
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz.
+ *
+ * @note Refer to Table 2-9 (Interrupts) on pages 104 - 106 from the TM4C123G Microcontroller Datasheet
+ * to view the Vector Number, Interrupt Request (IRQ) Number, and the Vector Address
+ * for each peripheral.
+ *
+ * @author Aaron Nanas
+ */
+
+#include "DDS_Mixer.h"
+
+// Phase accumulator, phase increment and volume of each voice
+static volatile uint32_t voice_phase[DDS_MIXER_VOICES];
+static volatile uint32_t voice_increment[DDS_MIXER_VOICES];
+static volatile uint32_t voice_volume[DDS_MIXER_VOICES];
+
+// Indicates whether the mixer owns Wide Timer 0A (between DDS_Mixer_Start and DDS_Mixer_Stop)
+static volatile uint8_t mixer_running = 0;
+
+// Execution time of the sample interrupt in clock cycles
+static volatile uint32_t cycles_per_sample = 0;
+static volatile uint32_t max_cycles_per_sample = 0;
+
+static void DDS_Mixer_Update_Sample_Timer(void)
+{
+	if (mixer_running == 0)
+	{
+		return;
+	}
+
+	uint32_t active_volume = 0;
+
+	for (int i = 0; i < DDS_MIXER_VOICES; i++)
+	{
+		active_volume |= voice_volume[i];
+	}
+
+	// Only generate the sample interrupts while a voice is audible
+	if (active_volume != 0)
+	{
+		TIMER2->CTL |= 0x01;
+	}
+	else
+	{
+		// Disable Timer 2A and hold the PWM output low (0% duty cycle)
+		TIMER2->CTL &= ~0x01;
+		WTIMER0->TAMATCHR = DDS_MIXER_PWM_PERIOD - 1;
+	}
+}
+
+void DDS_Mixer_Init(void)
+{
+	for (int i = 0; i < DDS_MIXER_VOICES; i++)
+	{
+		voice_phase[i] = 0;
+		voice_increment[i] = 0;
+		voice_volume[i] = 0;
+	}
+
+	// Set the R2 bit (Bit 2) in the RCGCTIMER register
+	// to enable the clock for Timer 2A
+	SYSCTL->RCGCTIMER |= 0x04;
+
+	// Wait until Timer 2 is ready to be accessed
+	while ((SYSCTL->PRTIMER & 0x04) == 0);
+
+	// Clear the TAEN bit (Bit 0) of the GPTMCTL register
+	// to disable Timer 2A
+	TIMER2->CTL &= ~0x01;
+
+	// Set the bits of the GPTMCFG field (Bits 2 to 0) in the GPTMCFG register
+	// 0x0 = Select the 32-bit timer configuration
+	TIMER2->CFG = 0x00;
+
+	// Set the bits of the TAMR field (Bits 1 to 0) to enable
+	// Periodic Timer mode in the GPTMTAMR register
+	TIMER2->TAMR = 0x02;
+
+	// Set the timer interval load value by writing to the
+	// TAILR field (Bits 31 to 0) in the GPTMTAILR register
+	// (20 ns * 1600) = 32 us (31.25 kHz)
+	TIMER2->TAILR = DDS_MIXER_PWM_PERIOD - 1;
+
+	// Set the TATOCINT bit (Bit 0) to 1 in the GPTMICR register
+	// The TATOCINT bit will be automatically cleared when it is set to 1
+	TIMER2->ICR = 0x01;
+
+	// Enable the Timer 2A interrupt by setting the TATOIM bit (Bit 0)
+	// in the GPTMIMR register
+	TIMER2->IMR |= 0x01;
+
+	// Set the priority level to 0 (highest) for the Timer 2A interrupt so that
+	// the samples are not delayed by the other interrupts
+	// Timer 2A has an IRQ of 23
+	NVIC->IP[23] = (0 << 5);
+
+	// Enable IRQ 23 for Timer 2A by setting Bit 23 in the ISER[0] register
+	NVIC->ISER[0] |= (1 << 23);
+}
+
+void DDS_Mixer_Start(void)
+{
+	cycles_per_sample = 0;
+	max_cycles_per_sample = 0;
+
+	// Take Wide Timer 0A over from the Tone driver
+	Tone_Stop();
+	Tone_Disable();
+
+	// Clear the TAEN bit (Bit 0) of the GPTMCTL register
+	// to disable Wide Timer 0A
+	WTIMER0->CTL &= ~0x01;
+
+	// Set the bits of the TAMR field (Bits 1 to 0) to enable Periodic Timer mode,
+	// set the TAAMS bit (Bit 3) to enable PWM mode, and set the TAMRSU bit (Bit 10)
+	// so that a new duty cycle is applied at the start of the next PWM period
+	WTIMER0->TAMR = 0x40A;
+
+	// Set the PWM period to one sample period
+	WTIMER0->TAILR = DDS_MIXER_PWM_PERIOD - 1;
+
+	// Start with a duty cycle of 0%
+	WTIMER0->TAMATCHR = DDS_MIXER_PWM_PERIOD - 1;
+
+	// Connect the PC4 pin to the timer output
+	// by setting Bit 4 in the AFSEL register
+	GPIOC->AFSEL |= 0x10;
+
+	// Set the TAEN bit (Bit 0) in the GPTMCTL register to enable Wide Timer 0A
+	WTIMER0->CTL |= 0x01;
+
+	// Enable Timer 2A if a voice is already audible
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	mixer_running = 1;
+	DDS_Mixer_Update_Sample_Timer();
+
+	__set_PRIMASK(primask);
+}
+
+void DDS_Mixer_Stop(void)
+{
+	mixer_running = 0;
+
+	// Clear the TAEN bit (Bit 0) of the GPTMCTL register
+	// to disable Timer 2A
+	TIMER2->CTL &= ~0x01;
+
+	// Return Wide Timer 0A to the Tone driver, and stop it and return PC4 to GPIO mode
+	Tone_Enable();
+	Tone_Stop();
+
+	// Restore the PWM mode used by the Tone driver
+	WTIMER0->TAMR = 0x0A;
+}
+
+void DDS_Mixer_Set_Voice(uint8_t voice, uint32_t frequency, uint8_t volume)
+{
+	if (voice >= DDS_MIXER_VOICES)
+	{
+		return;
+	}
+
+	// Phase increment = (frequency / sample rate) * 2^32
+	uint32_t increment = (uint32_t)(((uint64_t)frequency << 32) / DDS_MIXER_SAMPLE_RATE_HZ);
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	voice_increment[voice] = increment;
+	voice_volume[voice] = volume;
+	DDS_Mixer_Update_Sample_Timer();
+
+	__set_PRIMASK(primask);
+}
+
+void DDS_Mixer_Set_Voice_Note(uint8_t voice, uint8_t note, uint8_t volume)
+{
+	if (voice >= DDS_MIXER_VOICES)
+	{
+		return;
+	}
+
+	uint32_t note_period = Tone_Get_Note_Period(note);
+	uint32_t increment = 0;
+
+	// A note out of range silences the voice
+	if (note_period == 0)
+	{
+		volume = 0;
+	}
+	else
+	{
+		// Phase increment = (sample period / note period) * 2^32
+		// Both periods are measured in 50 MHz clock cycles
+		increment = (uint32_t)(((uint64_t)DDS_MIXER_PWM_PERIOD << 32) / note_period);
+	}
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	voice_increment[voice] = increment;
+	voice_volume[voice] = volume;
+	DDS_Mixer_Update_Sample_Timer();
+
+	__set_PRIMASK(primask);
+}
+
+void DDS_Mixer_Silence_Voice(uint8_t voice)
+{
+	if (voice >= DDS_MIXER_VOICES)
+	{
+		return;
+	}
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	voice_volume[voice] = 0;
+	DDS_Mixer_Update_Sample_Timer();
+
+	__set_PRIMASK(primask);
+}
+
+uint32_t DDS_Mixer_Get_Cycles_Per_Sample(void)
+{
+	return cycles_per_sample;
+}
+
+uint32_t DDS_Mixer_Get_Max_Cycles_Per_Sample(void)
+{
+	return max_cycles_per_sample;
+}
+
+void TIMER2A_Handler(void)
+{
+	uint32_t start_cycles = DWT->CYCCNT;
+
+	// Read the Timer 2A time-out interrupt flag
+	if (TIMER2->MIS & 0x01)
+	{
+		uint32_t mix = 0;
+
+		// Advance the phase of each voice and add the volume of the voices
+		// that are in the upper half of their cycle (Bit 31 of the phase is set)
+		for (int i = 0; i < DDS_MIXER_VOICES; i++)
+		{
+			uint32_t phase = voice_phase[i] + voice_increment[i];
+			voice_phase[i] = phase;
+			mix += (uint32_t)((int32_t)phase >> 31) & voice_volume[i];
+		}
+
+		// The PWM output is high from the start of the period until the count reaches
+		// the match value, so the high time of the output is equal to the mix
+		WTIMER0->TAMATCHR = (DDS_MIXER_PWM_PERIOD - 1) - mix;
+
+		// Acknowledge the Timer 2A interrupt and clear it
+		TIMER2->ICR = 0x01;
+	}
+
+	// Measure the execution time of the sample
+	uint32_t elapsed_cycles = DWT->CYCCNT - start_cycles;
+	cycles_per_sample = elapsed_cycles;
+
+	if (elapsed_cycles > max_cycles_per_sample)
+	{
+		max_cycles_per_sample = elapsed_cycles;
+	}
+}
@@ -0,0 +1,145 @@
+/**
+ * @file DDS_Mixer.h
+ *
+ * @brief Header file for the DDS_Mixer driver.
+ *
+ * This file contains the function definitions for the DDS_Mixer driver.
+ * It plays up to four square-wave voices at the same time on the DMT-1206 Magnetic Buzzer
+ * using direct digital synthesis (DDS).
+ *
+ * The Timer 2A interrupt is generated at the sample rate of 31.25 kHz. On every sample,
+ * the 32-bit phase accumulator of each voice is advanced by its phase increment, and the
+ * voices whose phase is in the upper half of the cycle add their volume to the mix.
+ * The mix is written as the duty cycle of a 31.25 kHz PWM signal generated by Wide Timer 0A
+ * on the buzzer pin (PC4), and the inertia of the buzzer averages the PWM signal.
+ *
+ * The execution time of each sample is measured with the DWT cycle counter and can be
+ * read with DDS_Mixer_Get_Cycles_Per_Sample and DDS_Mixer_Get_Max_Cycles_Per_Sample.
+ *
+ * The Timer 2A interrupt is only enabled while at least one voice has a volume greater than 0,
+ * so the mixer does not use the CPU while it is silent.
+ *
+ * @note The DDS mixer and the Tone driver share Wide Timer 0A. DDS_Mixer_Start disables the Tone
+ * driver (see Tone_Disable), so Tone_Start, Tone_Start_Note and Tone_Stop have no effect until
+ * DDS_Mixer_Stop is called. The Buzzer_Init and SysTick_Delay_Init functions must be called before DDS_Mixer_Init.
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz.
+ *
+ * @author Aaron Nanas
+ */
+
+#ifndef DDS_MIXER_H
+#define DDS_MIXER_H
+
+#include "TM4C123GH6PM.h"
+#include "Tone.h"
+
+// Number of voices that are mixed together
+#define DDS_MIXER_VOICES            4
+
+// Sample rate of the mixer and frequency of the PWM signal (50 MHz / 1600 = 31.25 kHz)
+#define DDS_MIXER_SAMPLE_RATE_HZ    31250
+#define DDS_MIXER_PWM_PERIOD        (TONE_TIMER_CLOCK_HZ / DDS_MIXER_SAMPLE_RATE_HZ)
+
+// Voices assigned to the users of the mixer
+// The songs of the music player and the sound effects (e.g. the button feedback) are mixed together
+#define DDS_MIXER_MUSIC_VOICE       0
+#define DDS_MIXER_EFFECT_VOICE      1
+
+// Maximum volume of a voice. The sum of the volumes of all voices must be less than DDS_MIXER_PWM_PERIOD.
+#define DDS_MIXER_MAX_VOLUME        255
+
+/**
+ * @brief Initializes Timer 2A to generate the sample interrupts of the DDS mixer.
+ *
+ * This function silences all voices and configures Timer 2A in periodic mode with a
+ * period of DDS_MIXER_PWM_PERIOD clock cycles. The timer is left disabled until
+ * DDS_Mixer_Start is called.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void DDS_Mixer_Init(void);
+
+/**
+ * @brief Starts the DDS mixer.
+ *
+ * This function takes Wide Timer 0A over from the Tone driver and configures it to generate
+ * the 31.25 kHz PWM signal on PC4. The Timer 2A sample interrupt is enabled while a voice is audible.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void DDS_Mixer_Start(void);
+
+/**
+ * @brief Stops the DDS mixer.
+ *
+ * This function disables the Timer 2A sample interrupt, stops Wide Timer 0A and returns
+ * it to the Tone driver with the configuration used by the Tone driver.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void DDS_Mixer_Stop(void);
+
+/**
+ * @brief Sets the frequency and the volume of a voice.
+ *
+ * @param voice The voice to be updated (0 - DDS_MIXER_VOICES - 1).
+ *
+ * @param frequency The frequency of the voice in Hz (up to half of the sample rate).
+ *
+ * @param volume The volume of the voice (0 - DDS_MIXER_MAX_VOLUME). A volume of 0 silences the voice.
+ *
+ * @return None
+ */
+void DDS_Mixer_Set_Voice(uint8_t voice, uint32_t frequency, uint8_t volume);
+
+/**
+ * @brief Sets the note and the volume of a voice.
+ *
+ * @param voice The voice to be updated (0 - DDS_MIXER_VOICES - 1).
+ *
+ * @param note The MIDI note number of the note (NOTE_C0 - NOTE_B8). A note out of range silences the voice.
+ *
+ * @param volume The volume of the voice (0 - DDS_MIXER_MAX_VOLUME). A volume of 0 silences the voice.
+ *
+ * @return None
+ */
+void DDS_Mixer_Set_Voice_Note(uint8_t voice, uint8_t note, uint8_t volume);
+
+/**
+ * @brief Silences a voice.
+ *
+ * @param voice The voice to be silenced (0 - DDS_MIXER_VOICES - 1).
+ *
+ * @return None
+ */
+void DDS_Mixer_Silence_Voice(uint8_t voice);
+
+/**
+ * @brief Returns the number of clock cycles spent in the most recent sample interrupt.
+ *
+ * The count is measured from the first to the last instruction of TIMER2A_Handler, so it does
+ * not include the 12-cycle exception entry and the 12-cycle exception return.
+ *
+ * @param None
+ *
+ * @return The number of clock cycles spent in the most recent sample interrupt.
+ */
+uint32_t DDS_Mixer_Get_Cycles_Per_Sample(void);
+
+/**
+ * @brief Returns the largest number of clock cycles spent in a sample interrupt since DDS_Mixer_Start was called.
+ *
+ * @param None
+ *
+ * @return The largest number of clock cycles spent in a sample interrupt.
+ */
+uint32_t DDS_Mixer_Get_Max_Cycles_Per_Sample(void);
+
+#endif
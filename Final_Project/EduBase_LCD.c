@@ -20,10 +20,110 @@
  */
  
 #include "EduBase_LCD.h"
+#include "EduBase_LCD_Buffer.h"
+#include "EduBase_LCD_Glyph.h"
+#include "EduBase_LCD_Animation.h"
 
 static uint8_t display_control = 0x00;
 static uint8_t display_mode = 0x00;
 
+// Queue of the bytes waiting to be transmitted to the LCD
+// Bits 7 to 0 of each entry hold the byte, and Bit 8 is set for a data write
+static volatile uint16_t lcd_queue[EDUBASE_LCD_QUEUE_SIZE];
+
+// Free-running indices of the queue: the head is advanced by the Timer 3A interrupt
+// and the tail is advanced by EduBase_LCD_Send_Command and EduBase_LCD_Send_Data
+static volatile uint8_t lcd_queue_head = 0;
+static volatile uint8_t lcd_queue_tail = 0;
+
+// Indicates whether the Timer 3A interrupt is transmitting the queue or waiting for
+// the execution time of the last instruction
+static volatile uint8_t lcd_busy = 0;
+
+// Number of queue entries dropped because the queue was full and the caller could not wait
+static volatile uint32_t lcd_dropped_entries = 0;
+
+static void EduBase_LCD_Queue_Init(void)
+{
+	lcd_queue_head = 0;
+	lcd_queue_tail = 0;
+	lcd_busy = 0;
+	lcd_dropped_entries = 0;
+	
+	// Set the R3 bit (Bit 3) in the RCGCTIMER register
+	// to enable the clock for Timer 3A
+	SYSCTL->RCGCTIMER |= 0x08;
+	
+	// Wait until Timer 3 is ready to be accessed
+	while ((SYSCTL->PRTIMER & 0x08) == 0);
+	
+	// Clear the TAEN bit (Bit 0) of the GPTMCTL register
+	// to disable Timer 3A
+	TIMER3->CTL &= ~0x01;
+	
+	// Set the bits of the GPTMCFG field (Bits 2 to 0) in the GPTMCFG register
+	// 0x0 = Select the 32-bit timer configuration
+	TIMER3->CFG = 0x00;
+	
+	// Set the bits of the TAMR field (Bits 1 to 0) to enable
+	// One-Shot Timer mode in the GPTMTAMR register
+	// The timer is started again by the interrupt after each instruction
+	TIMER3->TAMR = 0x01;
+	
+	// Set the TATOCINT bit (Bit 0) to 1 in the GPTMICR register
+	// The TATOCINT bit will be automatically cleared when it is set to 1
+	TIMER3->ICR = 0x01;
+	
+	// Enable the Timer 3A interrupt by setting the TATOIM bit (Bit 0)
+	// in the GPTMIMR register
+	TIMER3->IMR |= 0x01;
+	
+	// Set the priority level to 2 for the Timer 3A interrupt so that it does not
+	// delay the timer wheel (Timer 1A) or the sample interrupt (Timer 2A)
+	// Timer 3A has an IRQ of 35
+	NVIC->IP[35] = (2 << 5);
+	
+	// Enable IRQ 35 for Timer 3A by setting Bit 3 in the ISER[1] register
+	NVIC->ISER[1] |= (1 << 3);
+}
+
+static void EduBase_LCD_Queue_Write(uint16_t entry)
+{
+	while (1)
+	{
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		
+		if ((uint8_t)(lcd_queue_tail - lcd_queue_head) < EDUBASE_LCD_QUEUE_SIZE)
+		{
+			lcd_queue[lcd_queue_tail & (EDUBASE_LCD_QUEUE_SIZE - 1)] = entry;
+			lcd_queue_tail++;
+			
+			// Start transmitting the queue by setting the Timer 3A interrupt pending
+			// (Bit 3 in the ISPR[1] register) if it is not already running
+			if (!lcd_busy)
+			{
+				lcd_busy = 1;
+				NVIC->ISPR[1] = (1 << 3);
+			}
+			
+			__set_PRIMASK(primask);
+			return;
+		}
+		
+		__set_PRIMASK(primask);
+		
+		// The queue is full. Waiting for the Timer 3A interrupt to empty it would never end
+		// in an interrupt service routine (IPSR != 0) or while the interrupts are disabled,
+		// so the entry is dropped and counted instead
+		if ((__get_IPSR() != 0) || (primask != 0))
+		{
+			lcd_dropped_entries++;
+			return;
+		}
+	}
+}
+
 void EduBase_LCD_Ports_Init(void)
 {
 	// Enable the clock to Port A by setting the
@@ -44,7 +144,7 @@ void EduBase_LCD_Ports_Init(void)
 	
 	// Initialize the output of the PA5, PA4, PA3, and PA2 pins to zero
 	// by clearing Bits 5 to 2 in the DATA register
-	GPIOA->DATA &= ~0x3C;
+	GPIO_CLEAR_PINS(GPIOA, 0x3C);
 	
 	// Enable the clock to Port C by setting the
 	// R2 bit (Bit 2) in the RCGCGPIO register
@@ -63,7 +163,7 @@ void EduBase_LCD_Ports_Init(void)
 	
 	// Initialize the output of the PC6 pin to zero
 	// by clearing Bit 6 in the DATA register
-	GPIOC->DATA &= ~0x40;
+	GPIO_CLEAR_PINS(GPIOC, 0x40);
 	
 	// Enable the clock to Port E by setting the
 	// R4 bit (Bit 4) in the RCGCGPIO register
@@ -82,77 +182,62 @@ void EduBase_LCD_Ports_Init(void)
 	
 	// Initialize the output of the PE0 pin to zero
 	// by clearing Bit 0 in the DATA register
-	GPIOE->DATA &= ~0x01;
+	GPIO_CLEAR_PINS(GPIOE, 0x01);
 }
 
 void EduBase_LCD_Pulse_Enable(void)
 {
 	// Ensure that the output of the PC6 pin is zero
-	GPIOC->DATA &= ~0x40;
+	GPIO_CLEAR_PINS(GPIOC, 0x40);
 	SysTick_Delay1us(1);
 	
 	// Output a short pulse on the PC6 pin by setting Bit 6
-  // in the DATA register high and clearing it after 1 us. 
+	// in the DATA register high and clearing it after 1 us. 
 	// The minimum time for the enable pulse width must be at least greater than 450 ns
 	// during a read / write operation (page 49 of HD44780 datasheet)
-	GPIOC->DATA |= 0x40;
+	GPIO_SET_PINS(GPIOC, 0x40);
 	SysTick_Delay1us(1);
-	GPIOC->DATA &= ~0x40;
+	GPIO_CLEAR_PINS(GPIOC, 0x40);
 }
 
 void EduBase_LCD_Write_4_Bits(uint8_t data, uint8_t control_flag)
 {
-	// Set the upper nibble of the data on the data pins (PA2 - PA5)
-	GPIOA->DATA |= (data & 0xF0) >> 0x2;
+	// Output the upper nibble of the data on the data pins (PA2 - PA5)
+	// The masked write sets and clears the four pins with a single store,
+	// so the data lines do not need to be cleared after the enable pulse
+	GPIO_WRITE_PINS(GPIOA, 0x3C, (data & 0xF0) >> 0x2);
 	
 	// Set or clear the register select (RS) pin based on the control flag
 	// 0 for command and 1 for data
-	if (control_flag & 0x01)
-	{
-		GPIOE->DATA |= 0x01;
-	}
-	
-	else
-	{
-		GPIOE->DATA &= ~0x01;
-	}
+	GPIO_WRITE_PINS(GPIOE, 0x01, control_flag);
 	
 	// Output a short pulse on the PC6 pin to enable the LCD
 	EduBase_LCD_Pulse_Enable();
-	
-	// Clear the LCD data lines (PA2 - PA5) and provide a 1 ms delay
-	GPIOA->DATA &= ~0x3C;
-	SysTick_Delay1us(1000);
 }
 
 void EduBase_LCD_Send_Command(uint8_t command)
 {
-	// Transmit the upper nibble of the command byte
-	EduBase_LCD_Write_4_Bits(command & 0xF0, SEND_COMMAND_FLAG);
-	
-	// Transmit the lower nibble of the command byte
-	EduBase_LCD_Write_4_Bits(command << 0x4, SEND_COMMAND_FLAG);
-	
-	// Provide a delay based on the transmitted command
-	// The first two commands require 1.52 ms execution time
-	// while the rest of the commands need 37 us
-	if (command < 3)
-	{
-		SysTick_Delay1us(1520);
-	}
-	else
-	{
-		SysTick_Delay1us(37);
-	}
+	EduBase_LCD_Queue_Write(command);
 }
 
 void EduBase_LCD_Send_Data(uint8_t data)
 {
-	// Transmit the upper nibble of the data byte
-	EduBase_LCD_Write_4_Bits(data & 0xF0, SEND_DATA_FLAG);
-	
-	// Transmit the lower nibble of the data byte
-	EduBase_LCD_Write_4_Bits(data << 0x4, SEND_DATA_FLAG);
+	EduBase_LCD_Queue_Write(EDUBASE_LCD_QUEUE_DATA_FLAG | data);
+}
+
+uint8_t EduBase_LCD_Is_Busy(void)
+{
+	return lcd_busy;
+}
+
+uint32_t EduBase_LCD_Get_Dropped_Entries(void)
+{
+	return lcd_dropped_entries;
+}
+
+void EduBase_LCD_Wait(void)
+{
+	while (lcd_busy);
 }
 
 void EduBase_LCD_Init(void)
@@ -160,6 +245,9 @@ void EduBase_LCD_Init(void)
 	// Initialize the GPIO pins used by the LCD
 	EduBase_LCD_Ports_Init();
 	
+	// Initialize Timer 3A, which transmits the commands and data written to the queue
+	EduBase_LCD_Queue_Init();
+	
 	// Provide a delay of 50 ms after the LCD is powered on
 	SysTick_Delay1us(50000);
 	
@@ -175,6 +263,7 @@ void EduBase_LCD_Init(void)
 	
 	// Transmit a Function Set command to the LCD to configure it to use 4-bit mode
 	EduBase_LCD_Write_4_Bits(FUNCTION_SET | CONFIG_FOUR_BIT_MODE, SEND_COMMAND_FLAG);
+	SysTick_Delay1us(EDUBASE_LCD_COMMAND_DELAY_US);
 	
 	// Configure the LCD to use 5x8 dots and two rows
 	EduBase_LCD_Send_Command(FUNCTION_SET | CONFIG_5x8_DOTS | CONFIG_TWO_LINES);
@@ -192,11 +281,16 @@ void EduBase_LCD_Init(void)
 	// Turn off the cursor and the blinking of cursor position character
 	EduBase_LCD_Disable_Cursor_Blink();
 	EduBase_LCD_Disable_Cursor();
+	
+	// Mark the CGRAM slots as empty and initialize the framebuffer to match the cleared display
+	EduBase_LCD_Glyph_Init();
+	EduBase_LCD_Buffer_Init();
 }
 
 void EduBase_LCD_Clear_Display(void)
 {
 	EduBase_LCD_Send_Command(CLEAR_DISPLAY);
+	EduBase_LCD_Buffer_Notify_Clear();
 }
 
 void EduBase_LCD_Return_Home(void)
@@ -259,11 +353,13 @@ void EduBase_LCD_Enable_Cursor_Blink(void)
 void EduBase_LCD_Scroll_Display_Left(void)
 {
 	EduBase_LCD_Send_Command(CURSOR_OR_DISPLAY_SHIFT | DISPLAY_MOVE | MOVE_LEFT);
+	EduBase_LCD_Buffer_Invalidate();
 }
 
 void EduBase_LCD_Scroll_Display_Right(void)
 {
 	EduBase_LCD_Send_Command(CURSOR_OR_DISPLAY_SHIFT | DISPLAY_MOVE | MOVE_RIGHT);
+	EduBase_LCD_Buffer_Invalidate();
 }
 
 void EduBase_LCD_Left_to_Right(void)
@@ -278,7 +374,7 @@ void EduBase_LCD_Right_to_Left(void)
 	EduBase_LCD_Send_Command(ENTRY_MODE_SET | display_mode);
 }
 
-void EduBase_LCD_Create_Custom_Character(uint8_t location, uint8_t character_buffer[])
+void EduBase_LCD_Create_Custom_Character(uint8_t location, const uint8_t character_buffer[])
 {
 	location &= 0x7;
 	EduBase_LCD_Send_Command(SET_CGRAM_ADDR | (location << 3));
@@ -298,111 +394,54 @@ void EduBase_LCD_Display_String(char* string)
 
 void EduBase_LCD_Display_Integer(int value)
 {
-	char integer_buffer[32];
-	sprintf(integer_buffer, "%d", value);
+	char integer_buffer[FORMAT_BUFFER_SIZE];
+	Format_Signed_Decimal(integer_buffer, value);
 	EduBase_LCD_Display_String(integer_buffer);
 }
 
+void EduBase_LCD_Display_Fixed_Point(int32_t value, uint8_t decimals)
+{
+	char fixed_point_buffer[FORMAT_BUFFER_SIZE];
+	Format_Fixed_Point(fixed_point_buffer, value, decimals);
+	EduBase_LCD_Display_String(fixed_point_buffer);
+}
+
 void EduBase_LCD_Display_Double(double value)
 {
-	char double_buffer[32];
-	sprintf(double_buffer, "%.6f", value);
-	EduBase_LCD_Display_String(double_buffer);
+	// Convert the value to the Q16.16 format, rounded to the nearest step of 1 / 65536
+	double scaled_value = value * FORMAT_Q16_16_ONE;
+	int32_t fixed_point_value = (int32_t)((scaled_value < 0) ? (scaled_value - 0.5) : (scaled_value + 0.5));
+	EduBase_LCD_Display_Fixed_Point(fixed_point_value, EDUBASE_LCD_DOUBLE_DECIMALS);
 }
 
 void EduBase_LCD_Print_Text(char* message_1, char* message_2)
 {
-	// Enable and clear the display on the LCD
-	EduBase_LCD_Enable_Display();
-	EduBase_LCD_Clear_Display();
-	
-	// Set the cursor to the beginning of the top row (i.e. top leftmost position)
-	// and display the first message
-	EduBase_LCD_Set_Cursor(0, 0);
-	EduBase_LCD_Display_String(message_1);
+	// Enable the display if it has been disabled
+	if ((display_control & DISPLAY_ON) == 0)
+	{
+		EduBase_LCD_Enable_Display();
+	}
 	
-	// Set the cursor to the beginning of the second row (i.e. bottom leftmost position)
-	// and display the second message
-	EduBase_LCD_Set_Cursor(0, 1);
-	EduBase_LCD_Display_String(message_2);
+	// Write both lines of text to the framebuffer
+	// and transmit only the characters that have changed
+	EduBase_LCD_Buffer_Print_Text(message_1, message_2);
+	EduBase_LCD_Buffer_Flush();
 }
 
 void EduBase_LCD_Arrow_Sequence(void)
 {
-	// Enable and clear the display on the LCD
+	// Enable the display on the LCD and play the arrow sequence in the background
+	// Each step lasts 200 ms
 	EduBase_LCD_Enable_Display();
-	EduBase_LCD_Clear_Display();
-	
-	// Set the cursor to the beginning of the top row (i.e. top leftmost position)
-	// and display the right arrow character
-	EduBase_LCD_Set_Cursor(0, 0);
-	EduBase_LCD_Send_Data(0x03);
-	SysTick_Delay1ms(200);
-
-	// Shift the position of the right arrow to the right until it has almost reached the
-	// rightmost position of the top row
-	for (int i = 0; i < 14; i++)
-	{
-		EduBase_LCD_Scroll_Display_Right();
-		SysTick_Delay1ms(200);
-	}
-
-	// Clear the display on the LCD, set the cursor to the rigthmost position
-	// of the top row, and display the down arrow character
-	EduBase_LCD_Clear_Display();
-	EduBase_LCD_Set_Cursor(15, 0);
-	EduBase_LCD_Send_Data(0x01);
-	SysTick_Delay1ms(200);
-
-	// Clear the display on the LCD, set the cursor to the rightmost position
-	// of the bottom row, and display the left arrow character
-	EduBase_LCD_Clear_Display();
-	EduBase_LCD_Set_Cursor(15, 1);
-	EduBase_LCD_Send_Data(0x02);
-	SysTick_Delay1ms(200);
-
-	// Shift the position of the left arrow to the left until it has almost reached
-	// the leftmost position of the bottom row
-	for (int i = 0; i < 14; i++)
-	{
-		EduBase_LCD_Scroll_Display_Left();
-		SysTick_Delay1ms(200);
-	}
-
-	// Clear the display on the LCD, set the cursor to the leftmost position
-	// of the bottom row, and display the up arrow character
-	EduBase_LCD_Clear_Display();
-	EduBase_LCD_Set_Cursor(0, 1);
-	EduBase_LCD_Send_Data(0x00);
-	SysTick_Delay1ms(200);
-
-	// Set the cursor to the beginning of the top row (i.e. top leftmost position)
-	// and display the right arrow character
-	EduBase_LCD_Clear_Display();
-	EduBase_LCD_Set_Cursor(0, 0);
-	EduBase_LCD_Send_Data(0x03);
-	SysTick_Delay1ms(200);
+	EduBase_LCD_Animation_Play(arrow_sequence_animation, 200);
 }
 
 void EduBase_LCD_Display_Heart(void)
 {
-	// Enable and clear the display on the LCD
+	// Enable the display on the LCD and move the heart shape character
+	// to the left in the background. Each step lasts 200 ms
 	EduBase_LCD_Enable_Display();
-	EduBase_LCD_Clear_Display();
-	
-	// Set the cursor to the beginning of the top row (i.e. top leftmost position)
-	// and display the heart shape character. Provide a short delay of 200 ms
-	// after displaying the character
-	EduBase_LCD_Set_Cursor(15, 0);
-	EduBase_LCD_Send_Data(HEART_SHAPE_LOCATION);
-	SysTick_Delay1ms(200);
-	
-	// Move the heart shape character to the left until it reaches column 0 and row 0
-	for (int i = 0; i < 15; i++)
-	{
-		EduBase_LCD_Scroll_Display_Left();
-		SysTick_Delay1ms(200);
-	}
+	EduBase_LCD_Animation_Play(heart_animation, 200);
 }
 
 void EduBase_LCD_Controller(uint8_t button_status)
@@ -412,6 +451,7 @@ void EduBase_LCD_Controller(uint8_t button_status)
 		// SW5 is pressed
 		case 0x01:
 		{
+			EduBase_LCD_Animation_Stop();
 			EduBase_LCD_Print_Text("ECE 425L", "Tiva LaunchPad");
 			break;
 		}
@@ -433,9 +473,55 @@ void EduBase_LCD_Controller(uint8_t button_status)
 		// SW2 is pressed
 		case 0x08:
 		{
-			EduBase_LCD_Clear_Display();
-			EduBase_LCD_Disable_Display();
+			// Blank the screen of the controller instead of disabling the display,
+			// which would also hide the screens of the other applications
+			EduBase_LCD_Animation_Stop();
+			EduBase_LCD_Buffer_Clear();
+			EduBase_LCD_Buffer_Flush();
 			break;
 		}
 	}
 }
+
+void TIMER3A_Handler(void)
+{
+	// Acknowledge the timeout of the execution time of the previous instruction
+	// by setting the TATOCINT bit (Bit 0) in the GPTMICR register
+	TIMER3->ICR = 0x01;
+	
+	// Stop once the queue is empty and the last instruction has been executed
+	if (lcd_queue_head == lcd_queue_tail)
+	{
+		lcd_busy = 0;
+		return;
+	}
+	
+	uint16_t entry = lcd_queue[lcd_queue_head & (EDUBASE_LCD_QUEUE_SIZE - 1)];
+	lcd_queue_head++;
+	
+	uint8_t byte = entry & 0xFF;
+	uint8_t control_flag = (entry & EDUBASE_LCD_QUEUE_DATA_FLAG) ? SEND_DATA_FLAG : SEND_COMMAND_FLAG;
+	
+	// Transmit the upper nibble and then the lower nibble of the byte
+	EduBase_LCD_Write_4_Bits(byte & 0xF0, control_flag);
+	EduBase_LCD_Write_4_Bits(byte << 0x4, control_flag);
+	
+	// Select the execution time of the instruction
+	// The first two commands (Clear Display and Return Home) require 1.52 ms,
+	// the rest of the commands need 37 us, and data writes need 41 us
+	uint32_t delay_in_us = EDUBASE_LCD_COMMAND_DELAY_US;
+	
+	if (control_flag == SEND_DATA_FLAG)
+	{
+		delay_in_us = EDUBASE_LCD_DATA_DELAY_US;
+	}
+	else if (byte < 3)
+	{
+		delay_in_us = EDUBASE_LCD_CLEAR_HOME_DELAY_US;
+	}
+	
+	// Load the execution time into the TAILR field (Bits 31 to 0) of the GPTMTAILR register
+	// and set the TAEN bit (Bit 0) in the GPTMCTL register to start Timer 3A
+	TIMER3->TAILR = (delay_in_us * SYSTICK_DELAY_CYCLES_PER_US) - 1;
+	TIMER3->CTL |= 0x01;
+}
@@ -13,76 +13,50 @@
  *	- LCD Enable      [E]   (PC6)
  *  - Register Select [RS]  (PE0)
  *
+ * The commands and data sent after EduBase_LCD_Init are written to a queue and return immediately.
+ * The Timer 3A interrupt transmits one byte at a time and then waits for the execution time of the
+ * instruction before transmitting the next byte. EduBase_LCD_Wait can be used when the caller
+ * needs the LCD to have executed every queued instruction.
+ *
+ * @note The LCD functions must only be called from the main loop or the scheduler tasks. When the queue
+ * is full, they wait for the Timer 3A interrupt (priority 2) to transmit a byte. In an interrupt service
+ * routine or while the interrupts are disabled, that wait would never end, so the byte is dropped instead
+ * and counted by EduBase_LCD_Get_Dropped_Entries. EduBase_LCD_Wait must not be called from those contexts.
+ *
  * @note For more information regarding the LCD, refer to the HD44780 LCD Controller Datasheet.
  * Link: https://www.sparkfun.com/datasheets/LCD/HD44780.pdf
  *
  * @author Aaron Nanas
  */
 
+#ifndef EDUBASE_LCD_H
+#define EDUBASE_LCD_H
+
 #include "TM4C123GH6PM.h"
 #include "SysTick_Delay.h"
+#include "GPIO_Pins.h"
+#include "Format.h"
 #include <string.h>
-#include <stdio.h>
 
-static uint8_t up_arrow[8] =
-{
-	0x00,
-	0x04,
-	0x0E,
-	0x15,
-	0x04,
-	0x04,
-	0x04,
-	0x04
-};
-	
-static uint8_t down_arrow[8] = 
-{
-	0x04,
-	0x04,
-	0x04,
-	0x04,
-	0x04,
-	0x15,
-	0x0E,
-	0x04
-};
-	
-static uint8_t left_arrow[8] =
-{
-	0x00,
-	0x04,
-	0x08,
-	0x1F,
-	0x08,
-	0x04,
-	0x00,
-	0x00
-};
-	
-static uint8_t right_arrow[8] =
-{
-	0x00,
-	0x04,
-	0x02,
-	0x1F,
-	0x02,
-	0x04,
-	0x00,
-	0x00
-};
+// Execution times of the HD44780 instructions in microseconds (Table 6 of the HD44780 datasheet, fosc = 270 kHz)
+// The R/W pin of the LCD is tied to ground on the EduBase board, so the busy flag cannot be read back
+// and each instruction is followed by a delay equal to its execution time.
+// - Clear Display and Return Home: 1.52 ms
+// - Other commands: 37 us
+// - Data writes: 37 us, plus 4 us for the address counter update (tADD)
+#define EDUBASE_LCD_CLEAR_HOME_DELAY_US     1520
+#define EDUBASE_LCD_COMMAND_DELAY_US        37
+#define EDUBASE_LCD_DATA_DELAY_US           41
 
-static uint8_t heart_shape[8] =
-{
-	0x00,
-  0x00,
-  0x0A,
-  0x1F,
-  0x1F,
-  0x0E,
-  0x04,
-  0x00
-};
+// Number of bytes that can wait in the LCD queue (must be a power of two no larger than 128)
+// A full redraw of the framebuffer needs at most 49 bytes
+#define EDUBASE_LCD_QUEUE_SIZE              64
+
+// Marks a data write in an entry of the LCD queue
+#define EDUBASE_LCD_QUEUE_DATA_FLAG         0x100
+
+// Number of decimals displayed by EduBase_LCD_Display_Double
+#define EDUBASE_LCD_DOUBLE_DECIMALS         4
 
 enum LCD_Commands
 {
@@ -138,15 +112,6 @@ enum LCD_Register_Select_Flags
 	SEND_DATA_FLAG          = 0x01
 };
 
-enum Custom_Character_CGRAM_Locations
-{
-	UP_ARROW_LOCATION       = 0x00,
-	DOWN_ARROW_LOCATION     = 0x01,
-	LEFT_ARROW_LOCATION     = 0x02,
-	RIGHT_ARROW_LOCATION    = 0x03,
-	HEART_SHAPE_LOCATION    = 0x04
-};
-
 /**
  * @brief Initializes the GPIO pins used by the 16x2 LCD on the EduBase board.
  *
@@ -187,6 +152,9 @@ void EduBase_LCD_Pulse_Enable(void);
  * or a command write. After setting the data lines and control pin accordingly, it pulses 
  * the LCD enable pin to signal the LCD to latch in the data.
  *
+ * The caller is responsible for waiting for the execution time of the instruction
+ * once both nibbles have been transmitted.
+ *
  * @param data The 8-bit data to be sent to the LCD.
  
  * @param control_flag A flag indicating whether the operation is a data write or a command write.
@@ -200,32 +168,68 @@ void EduBase_LCD_Write_4_Bits(uint8_t data, uint8_t control_flag);
 /**
  * @brief Sends a command to the LCD.
  *
- * This function sends an 8-bit command to the LCD using the EduBase_LCD_Write_4_Bits function.
- * It transmits the upper nibble of the command first, and then it transmits the lower nibble. The timing 
- * of the delays after sending the command depends on the specific command being executed.
- * For the first two commands (i.e. Clear Display and Return Home), a delay of 1.52 ms is required.
- * The rest of the commands require a delay of 37 us.
+ * This function writes an 8-bit command to the LCD queue and returns immediately.
+ * The Timer 3A interrupt transmits the upper nibble of the command first, and then the lower nibble
+ * using the EduBase_LCD_Write_4_Bits function. The next byte in the queue is transmitted once
+ * the execution time of the command has elapsed: 1.52 ms for the first two commands
+ * (i.e. Clear Display and Return Home), and 37 us for the rest of the commands.
+ *
+ * If the queue is full, this function waits until a byte has been transmitted.
  *
  * @param command The 8-bit command to be sent to the LCD.
  *
  * @return None
  *
  * @note The commands are listed on pages 24-25 of the HD44780 LCD Controller datasheet.
+ * This function must not be called from an interrupt handler.
  */
 void EduBase_LCD_Send_Command(uint8_t command);
 
 /**
  * @brief Sends an 8-bit data byte to the LCD.
  *
- * This function sends an 8-bit data byte to the LCD using the EduBase_LCD_Write_4_Bits function.
- * It transmits the upper nibble of the command first, and then it transmits the lower nibble.
+ * This function writes an 8-bit data byte to the LCD queue and returns immediately.
+ * The Timer 3A interrupt transmits the byte and then waits 41 us for the LCD to write the data
+ * and update its address counter before transmitting the next byte.
+ *
+ * If the queue is full, this function waits until a byte has been transmitted.
  *
  * @param data The 8-bit data byte to be sent to the LCD.
  *
  * @return None
+ *
+ * @note This function must not be called from an interrupt handler.
  */
 void EduBase_LCD_Send_Data(uint8_t data);
 
+/**
+ * @brief Indicates whether the LCD queue is being transmitted.
+ *
+ * @param None
+ *
+ * @return 1 if bytes are waiting in the queue or the LCD is executing the last instruction; Otherwise, 0.
+ */
+uint8_t EduBase_LCD_Is_Busy(void);
+
+/**
+ * @brief Returns the number of bytes dropped because the LCD queue was full in an interrupt
+ * service routine or while the interrupts were disabled.
+ *
+ * @param None
+ *
+ * @return The number of bytes dropped since the LCD was initialized.
+ */
+uint32_t EduBase_LCD_Get_Dropped_Entries(void);
+
+/**
+ * @brief Waits until every byte in the LCD queue has been transmitted and executed by the LCD.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void EduBase_LCD_Wait(void);
+
 /**
  * @brief Initializes the LCD module connected to the EduBase board.
  *
@@ -386,6 +390,8 @@ void EduBase_LCD_Right_to_Left(void);
  *
  * This function creates a custom character and stores it in the LCD's 
  * Character Generator RAM (CGRAM) at the specified location.
+ * The EduBase_LCD_Glyph driver uses this function to manage the CGRAM slots,
+ * so it should not be called directly when glyphs are used.
  *
  * @param location The location (0-7) in CGRAM where the custom character will be stored.
  *
@@ -393,7 +399,7 @@ void EduBase_LCD_Right_to_Left(void);
  *
  * @return None
  */
-void EduBase_LCD_Create_Custom_Character(uint8_t location, uint8_t character_buffer[]);
+void EduBase_LCD_Create_Custom_Character(uint8_t location, const uint8_t character_buffer[]);
 
 /**
  * @brief Displays a string on the LCD.
@@ -408,18 +414,34 @@ void EduBase_LCD_Create_Custom_Character(uint8_t location, uint8_t character_buf
 void EduBase_LCD_Display_String(char* string);
 
 /**
- * @brief
+ * @brief Displays a signed integer on the LCD at the current cursor position.
+ *
+ * The value is converted to a decimal string with the Format driver.
  *
- * @param 
+ * @param value The integer to be displayed.
  *
  * @return None
  */
 void EduBase_LCD_Display_Integer(int value);
 
 /**
- * @brief
+ * @brief Displays a Q16.16 fixed-point value on the LCD at the current cursor position.
  *
- * @param 
+ * @param value The Q16.16 value to be displayed (see Format.h).
+ *
+ * @param decimals The number of digits after the decimal point (0 - 9).
+ *
+ * @return None
+ */
+void EduBase_LCD_Display_Fixed_Point(int32_t value, uint8_t decimals);
+
+/**
+ * @brief Displays a floating-point value on the LCD at the current cursor position.
+ *
+ * The value is converted to the Q16.16 format and displayed with EDUBASE_LCD_DOUBLE_DECIMALS decimals,
+ * so it must be between -32768 and 32767.
+ *
+ * @param value The floating-point value to be displayed.
  *
  * @return None
  */
@@ -428,10 +450,14 @@ void EduBase_LCD_Display_Double(double value);
 /**
  * @brief Prints two lines of text on the LCD.
  *
- * This function enables the display, clears the display, and then prints two lines of text 
+ * This function enables the display if it is disabled, and then prints two lines of text 
  * on the LCD. The first line is printed from the beginning of the display, and the second 
  * line is printed immediately below the first line.
  *
+ * The text is written to the framebuffer (see EduBase_LCD_Buffer.h) and only the characters
+ * that differ from the current LCD contents are transmitted, so printing the same text again
+ * does not access the LCD.
+ *
  * @param message_1 A char pointer that holds the address of a sequence of char values (i.e. string)
  *                  to be displayed on the first row of the LCD.
  *
@@ -443,7 +469,11 @@ void EduBase_LCD_Display_Double(double value);
 void EduBase_LCD_Print_Text(char* message_1, char* message_2);
 
 /**
- * @brief
+ * @brief Starts the arrow sequence animation on the LCD.
+ *
+ * The arrow characters move around the edges of the display, one step every 200 ms.
+ * The animation is played in the background by the EduBase_LCD_Animation driver,
+ * so this function returns immediately.
  *
  * @param None
  *
@@ -452,7 +482,11 @@ void EduBase_LCD_Print_Text(char* message_1, char* message_2);
 void EduBase_LCD_Arrow_Sequence(void);
 
 /**
- * @brief
+ * @brief Starts the heart shape animation on the LCD.
+ *
+ * The heart shape character moves from the rightmost position to the leftmost position
+ * of the top row, one step every 200 ms. The animation is played in the background by the
+ * EduBase_LCD_Animation driver, so this function returns immediately.
  *
  * @param None
  *
@@ -461,10 +495,31 @@ void EduBase_LCD_Arrow_Sequence(void);
 void EduBase_LCD_Display_Heart(void);
 
 /**
- * @brief
+ * @brief Updates the LCD based on the EduBase buttons that have been pressed.
+ *
+ * A button press replaces the animation that is playing:
+ *	- SW5: Prints two lines of text.
+ *	- SW4: Starts the arrow sequence animation.
+ *	- SW3: Starts the heart shape animation.
+ *	- SW2: Clears the screen of the controller.
  *
- * @param button_status
+ * @param button_status The status of the EduBase buttons (SW5 = Bit 0, SW2 = Bit 3).
  *
  * @return None
  */
 void EduBase_LCD_Controller(uint8_t button_status);
+
+/**
+ * @brief The interrupt service routine (ISR) for Timer 3A.
+ *
+ * This function is called once the execution time of the last instruction has elapsed.
+ * It transmits the next byte in the LCD queue and restarts Timer 3A with the execution
+ * time of the instruction, or it stops when the queue is empty.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void TIMER3A_Handler(void);
+
+#endif
@@ -0,0 +1,261 @@
+/**
+ * @file EduBase_LCD_Animation.c
+ *
+ * @brief Source code for the EduBase_LCD_Animation driver.
+ *
+ * This file contains the function definitions for the EduBase_LCD_Animation driver.
+ * It plays keyframe scripts and marquees on the EduBase Board 16x2 LCD from a scheduler task.
+ *
+ * @author Aaron Nanas
+ */
+
+#include "EduBase_LCD_Animation.h"
+
+// Size of a keyframe in bytes
+#define ANIMATION_KEYFRAME_SIZE     4
+
+// Event posted to the animation task to execute the first step of a new animation
+#define ANIMATION_EVENT_START       0x01
+
+// Kinds of animations
+#define ANIMATION_NONE              0
+#define ANIMATION_SCRIPT            1
+#define ANIMATION_MARQUEE           2
+
+// The right arrow moves along the top row, the down arrow and the left arrow
+// are displayed on the right side, and the left arrow moves along the bottom row
+// before the up arrow and the right arrow are displayed on the left side
+const uint8_t arrow_sequence_animation[] =
+{
+	ANIMATION_SPRITE(GLYPH_RIGHT_ARROW, 0, 0),
+	ANIMATION_SCROLL_RIGHT(14),
+	ANIMATION_SPRITE(GLYPH_DOWN_ARROW, 15, 0),
+	ANIMATION_SPRITE(GLYPH_LEFT_ARROW, 15, 1),
+	ANIMATION_SCROLL_LEFT(14),
+	ANIMATION_SPRITE(GLYPH_UP_ARROW, 0, 1),
+	ANIMATION_SPRITE(GLYPH_RIGHT_ARROW, 0, 0),
+	ANIMATION_END
+};
+
+// The heart shape moves from the rightmost position to the leftmost position of the top row
+const uint8_t heart_animation[] =
+{
+	ANIMATION_SPRITE(GLYPH_HEART_SHAPE, 15, 0),
+	ANIMATION_SCROLL_LEFT(15),
+	ANIMATION_END
+};
+
+static uint8_t animation_priority = 0;
+static uint8_t animation_screen = 0;
+static uint8_t animation_kind = ANIMATION_NONE;
+static uint16_t animation_tick_ms = 0;
+
+// Script that is playing and the offset of its next keyframe
+static const uint8_t *animation_script = 0;
+static uint16_t keyframe_offset = 0;
+
+// Remaining ticks of the scroll or wait keyframe that is being executed, and the opcode of that keyframe
+static uint8_t remaining_ticks = 0;
+static uint8_t repeated_opcode = 0;
+
+// Text, length, row, and current offset of the marquee
+static const char *marquee_text = 0;
+static uint16_t marquee_length = 0;
+static uint8_t marquee_row = 0;
+static uint16_t marquee_offset = 0;
+
+static void EduBase_LCD_Animation_Repeat_Step(void)
+{
+	// Scroll the framebuffer, so the animation keeps running while its screen is in the background
+	if (repeated_opcode == ANIMATION_OPCODE_SCROLL_LEFT)
+	{
+		EduBase_LCD_Buffer_Scroll_Left();
+		EduBase_LCD_Buffer_Flush();
+	}
+	else if (repeated_opcode == ANIMATION_OPCODE_SCROLL_RIGHT)
+	{
+		EduBase_LCD_Buffer_Scroll_Right();
+		EduBase_LCD_Buffer_Flush();
+	}
+
+	remaining_ticks--;
+}
+
+static uint8_t EduBase_LCD_Animation_Script_Step(void)
+{
+	// Continue the scroll or the wait keyframe that lasts several ticks
+	if (remaining_ticks > 0)
+	{
+		EduBase_LCD_Animation_Repeat_Step();
+		return 1;
+	}
+
+	while (1)
+	{
+		const uint8_t *keyframe = &animation_script[keyframe_offset];
+		keyframe_offset += ANIMATION_KEYFRAME_SIZE;
+
+		switch (keyframe[0])
+		{
+			case ANIMATION_OPCODE_SPRITE:
+			{
+				EduBase_LCD_Buffer_Clear();
+				EduBase_LCD_Buffer_Write_Glyph(keyframe[2], keyframe[3], keyframe[1]);
+				EduBase_LCD_Buffer_Flush();
+			}
+			return 1;
+
+			case ANIMATION_OPCODE_SCROLL_LEFT:
+			case ANIMATION_OPCODE_SCROLL_RIGHT:
+			case ANIMATION_OPCODE_WAIT:
+			{
+				if (keyframe[1] != 0)
+				{
+					repeated_opcode = keyframe[0];
+					remaining_ticks = keyframe[1];
+					EduBase_LCD_Animation_Repeat_Step();
+					return 1;
+				}
+			}
+			break;
+
+			case ANIMATION_OPCODE_REPEAT:
+			{
+				keyframe_offset = 0;
+			}
+			break;
+
+			default:
+			{
+				return 0;
+			}
+		}
+	}
+}
+
+static void EduBase_LCD_Animation_Marquee_Step(void)
+{
+	// Write the 16 characters of the text that start at the current offset,
+	// followed by the gap and the beginning of the text
+	uint16_t index = marquee_offset;
+
+	for (uint8_t col = 0; col < EDUBASE_LCD_COLUMNS; col++)
+	{
+		char character = (index < marquee_length) ? marquee_text[index] : ' ';
+		EduBase_LCD_Buffer_Write_Character(col, marquee_row, character);
+
+		index++;
+
+		if (index == (marquee_length + ANIMATION_MARQUEE_GAP))
+		{
+			index = 0;
+		}
+	}
+
+	EduBase_LCD_Buffer_Flush();
+
+	marquee_offset++;
+
+	if (marquee_offset == (marquee_length + ANIMATION_MARQUEE_GAP))
+	{
+		marquee_offset = 0;
+	}
+}
+
+static void EduBase_LCD_Animation_Task(uint32_t events)
+{
+	(void)events;
+
+	uint8_t playing = 0;
+
+	// Draw on the screen that was selected when the animation was started
+	uint8_t previous_screen = EduBase_LCD_Buffer_Select_Screen(animation_screen);
+
+	if (animation_kind == ANIMATION_SCRIPT)
+	{
+		playing = EduBase_LCD_Animation_Script_Step();
+	}
+	else if (animation_kind == ANIMATION_MARQUEE)
+	{
+		EduBase_LCD_Animation_Marquee_Step();
+		playing = 1;
+	}
+
+	EduBase_LCD_Buffer_Select_Screen(previous_screen);
+
+	// Wait one tick before the next step
+	if (playing)
+	{
+		Scheduler_Set_Timeout(animation_priority, animation_tick_ms);
+	}
+	else
+	{
+		animation_kind = ANIMATION_NONE;
+	}
+}
+
+void EduBase_LCD_Animation_Init(uint8_t priority)
+{
+	animation_priority = priority;
+	animation_kind = ANIMATION_NONE;
+
+	Scheduler_Add_Task(priority, &EduBase_LCD_Animation_Task);
+}
+
+void EduBase_LCD_Animation_Play(const uint8_t script[], uint16_t tick_ms)
+{
+	EduBase_LCD_Animation_Stop();
+
+	animation_script = script;
+	animation_screen = EduBase_LCD_Buffer_Get_Selected_Screen();
+	keyframe_offset = 0;
+	remaining_ticks = 0;
+	animation_tick_ms = tick_ms;
+	animation_kind = ANIMATION_SCRIPT;
+
+	// Execute the first keyframe from the animation task
+	Scheduler_Post(animation_priority, ANIMATION_EVENT_START);
+}
+
+void EduBase_LCD_Animation_Marquee(const char *text, uint8_t row, uint16_t tick_ms)
+{
+	EduBase_LCD_Animation_Stop();
+
+	uint16_t length = strlen(text);
+
+	// Display a text that fits in the row without scrolling
+	if (length <= EDUBASE_LCD_COLUMNS)
+	{
+		for (uint8_t col = 0; col < EDUBASE_LCD_COLUMNS; col++)
+		{
+			EduBase_LCD_Buffer_Write_Character(col, row, (col < length) ? text[col] : ' ');
+		}
+
+		EduBase_LCD_Buffer_Flush();
+		return;
+	}
+
+	marquee_text = text;
+	animation_screen = EduBase_LCD_Buffer_Get_Selected_Screen();
+	marquee_length = length;
+	marquee_row = row;
+	marquee_offset = 0;
+	animation_tick_ms = tick_ms;
+	animation_kind = ANIMATION_MARQUEE;
+
+	// Execute the first step from the animation task
+	Scheduler_Post(animation_priority, ANIMATION_EVENT_START);
+}
+
+void EduBase_LCD_Animation_Stop(void)
+{
+	animation_kind = ANIMATION_NONE;
+
+	// Cancel the timeout of the next step
+	Scheduler_Set_Timeout(animation_priority, 0);
+}
+
+uint8_t EduBase_LCD_Animation_Is_Playing(void)
+{
+	return (animation_kind != ANIMATION_NONE);
+}
@@ -0,0 +1,123 @@
+/**
+ * @file EduBase_LCD_Animation.h
+ *
+ * @brief Header file for the EduBase_LCD_Animation driver.
+ *
+ * This file contains the function definitions for the EduBase_LCD_Animation driver.
+ * It plays animations on the EduBase Board 16x2 LCD in the background, one step per tick.
+ *
+ * The animations are executed by a scheduler task. After each step, the task sets a timeout
+ * for the length of a tick and returns, so the other tasks keep running while an animation is playing.
+ * Starting a new animation replaces the current one, and EduBase_LCD_Animation_Stop cancels it.
+ * An animation draws on the virtual screen that is selected when it is started (see EduBase_LCD_Buffer.h),
+ * and it keeps playing while that screen is in the background.
+ *
+ * Two kinds of animations are supported:
+ *	- Scripts: constant arrays of 4-byte keyframes that are terminated by ANIMATION_END.
+ *	  - ANIMATION_SPRITE(glyph, col, row): Clears the framebuffer, draws a glyph (see EduBase_LCD_Glyph.h)
+ *	    at the specified cell, and waits one tick.
+ *	  - ANIMATION_SCROLL_LEFT(steps) and ANIMATION_SCROLL_RIGHT(steps): Rotates both rows
+ *	    of the framebuffer, one position per tick.
+ *	  - ANIMATION_WAIT(ticks): Waits for the specified number of ticks.
+ *	  - ANIMATION_REPEAT: Plays the script again from its first keyframe.
+ *	  - ANIMATION_END: Marks the end of the script.
+ *	- Marquees: text longer than 16 characters that scrolls through one row of the framebuffer,
+ *	  one character per tick, until the animation is stopped or replaced.
+ *
+ * @note The Scheduler_Init and EduBase_LCD_Init functions must be called before EduBase_LCD_Animation_Init.
+ *
+ * @author Aaron Nanas
+ */
+
+#ifndef EDUBASE_LCD_ANIMATION_H
+#define EDUBASE_LCD_ANIMATION_H
+
+#include "TM4C123GH6PM.h"
+#include "Scheduler.h"
+#include "EduBase_LCD.h"
+#include "EduBase_LCD_Buffer.h"
+#include "EduBase_LCD_Glyph.h"
+
+// Opcodes of the animation scripts
+#define ANIMATION_OPCODE_SPRITE         0x01
+#define ANIMATION_OPCODE_SCROLL_LEFT    0x02
+#define ANIMATION_OPCODE_SCROLL_RIGHT   0x03
+#define ANIMATION_OPCODE_WAIT           0x04
+#define ANIMATION_OPCODE_REPEAT         0xFE
+#define ANIMATION_OPCODE_END            0xFF
+
+// Macros used to write the keyframes of a script
+#define ANIMATION_SPRITE(glyph, col, row)   ANIMATION_OPCODE_SPRITE, (glyph), (col), (row)
+#define ANIMATION_SCROLL_LEFT(steps)        ANIMATION_OPCODE_SCROLL_LEFT, (steps), 0, 0
+#define ANIMATION_SCROLL_RIGHT(steps)       ANIMATION_OPCODE_SCROLL_RIGHT, (steps), 0, 0
+#define ANIMATION_WAIT(ticks)               ANIMATION_OPCODE_WAIT, (ticks), 0, 0
+#define ANIMATION_REPEAT                    ANIMATION_OPCODE_REPEAT, 0, 0, 0
+#define ANIMATION_END                       ANIMATION_OPCODE_END, 0, 0, 0
+
+// Number of spaces between the end and the beginning of the text of a marquee
+#define ANIMATION_MARQUEE_GAP           4
+
+// Animations stored in flash memory
+extern const uint8_t arrow_sequence_animation[];
+extern const uint8_t heart_animation[];
+
+/**
+ * @brief Initializes the animation engine and registers its task with the scheduler.
+ *
+ * @param priority The priority level of the animation task (0 - 31). It must be higher
+ *                 (i.e. a lower number) than the priority of the tasks that start animations.
+ *
+ * @return None
+ */
+void EduBase_LCD_Animation_Init(uint8_t priority);
+
+/**
+ * @brief Starts playing an animation script, replacing the current animation.
+ *
+ * The first keyframe is executed immediately.
+ *
+ * @param script A pointer to the first keyframe of the script.
+ *
+ * @param tick_ms The length of a tick in milliseconds.
+ *
+ * @return None
+ */
+void EduBase_LCD_Animation_Play(const uint8_t script[], uint16_t tick_ms);
+
+/**
+ * @brief Starts scrolling a text through one row of the LCD, replacing the current animation.
+ *
+ * The other row of the framebuffer is not modified. If the text fits in the row,
+ * it is displayed without scrolling.
+ *
+ * @param text The null-terminated text to be displayed. It must remain valid while the marquee is playing.
+ *
+ * @param row The row of the marquee (0 - 1).
+ *
+ * @param tick_ms The time between two shifts of the text in milliseconds.
+ *
+ * @return None
+ */
+void EduBase_LCD_Animation_Marquee(const char *text, uint8_t row, uint16_t tick_ms);
+
+/**
+ * @brief Cancels the current animation.
+ *
+ * The LCD keeps the contents of the last step that was displayed.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void EduBase_LCD_Animation_Stop(void);
+
+/**
+ * @brief Indicates whether an animation is playing.
+ *
+ * @param None
+ *
+ * @return 1 if an animation is playing; Otherwise, 0.
+ */
+uint8_t EduBase_LCD_Animation_Is_Playing(void);
+
+#endif
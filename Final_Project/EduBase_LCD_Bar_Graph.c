@@ -0,0 +1,54 @@
+/**
+ * @file EduBase_LCD_Bar_Graph.c
+ *
+ * @brief Source code for the EduBase_LCD_Bar_Graph driver.
+ *
+ * This file contains the function definitions for the EduBase_LCD_Bar_Graph driver.
+ * It draws horizontal bar graphs with the partial block glyphs and the full block character.
+ *
+ * @author Aaron Nanas
+ */
+
+#include "EduBase_LCD_Bar_Graph.h"
+
+// Character of the LCD character ROM (A00) with every dot on
+#define FULL_BLOCK_CHARACTER    0xFF
+
+void EduBase_LCD_Bar_Graph_Write(uint8_t col, uint8_t row, uint8_t width, uint32_t value, uint32_t full_scale)
+{
+	uint32_t total_steps = width * BAR_GRAPH_STEPS_PER_CELL;
+	uint32_t steps = total_steps;
+
+	// Scale the value to the number of steps of the bar graph
+	if ((full_scale != 0) && (value < full_scale))
+	{
+		steps = ((uint64_t)value * total_steps) / full_scale;
+	}
+
+	for (uint8_t i = 0; i < width; i++)
+	{
+		if (steps >= BAR_GRAPH_STEPS_PER_CELL)
+		{
+			EduBase_LCD_Buffer_Write_Character(col + i, row, FULL_BLOCK_CHARACTER);
+			steps -= BAR_GRAPH_STEPS_PER_CELL;
+		}
+		else if (steps > 0)
+		{
+			// The tip of the bar uses the partial block with the remaining number of columns
+			EduBase_LCD_Buffer_Write_Glyph(col + i, row, GLYPH_BAR_1 + (steps - 1));
+			steps = 0;
+		}
+		else
+		{
+			EduBase_LCD_Buffer_Write_Character(col + i, row, ' ');
+		}
+	}
+}
+
+void EduBase_LCD_Bar_Graph_Display(uint8_t col, uint8_t row, uint8_t width, uint32_t value, uint32_t full_scale)
+{
+	EduBase_LCD_Bar_Graph_Write(col, row, width, value, full_scale);
+
+	// Transmit the cells that have changed
+	EduBase_LCD_Buffer_Flush();
+}
@@ -0,0 +1,69 @@
+/**
+ * @file EduBase_LCD_Bar_Graph.h
+ *
+ * @brief Header file for the EduBase_LCD_Bar_Graph driver.
+ *
+ * This file contains the function definitions for the EduBase_LCD_Bar_Graph driver.
+ * It draws horizontal bar graphs on the EduBase Board 16x2 LCD with a resolution of
+ * five steps per character, one step for each column of dots.
+ *
+ * The filled cells of a bar use the full block character (0xFF) of the LCD character ROM,
+ * and the cell at the tip of the bar uses one of the partial block glyphs (GLYPH_BAR_1 - GLYPH_BAR_4,
+ * see EduBase_LCD_Glyph.h). A bar therefore uses a single CGRAM slot at a time.
+ *
+ * The bars are written to the framebuffer (see EduBase_LCD_Buffer.h), so a flush only transmits
+ * the cells between the previous and the new tip of each bar. A change of a few steps transmits
+ * one or two characters and one cursor command (about 0.1 ms), so a bar can be updated every time
+ * the ADC is sampled without saturating the LCD bus.
+ *
+ * @author Aaron Nanas
+ */
+
+#include "TM4C123GH6PM.h"
+#include "EduBase_LCD.h"
+#include "EduBase_LCD_Buffer.h"
+#include "EduBase_LCD_Glyph.h"
+
+// Number of steps of a bar graph in each character (one step per column of dots)
+#define BAR_GRAPH_STEPS_PER_CELL    5
+
+/**
+ * @brief Writes a horizontal bar graph to the framebuffer.
+ *
+ * The length of the bar is proportional to value and is rounded down to a step. The bar is full
+ * when value is greater than or equal to full_scale. The framebuffer is not flushed, so several bars
+ * can be written before they are displayed.
+ *
+ * @param col The leftmost column of the bar graph (0 - 15).
+ *
+ * @param row The row of the bar graph (0 - 1).
+ *
+ * @param width The number of cells of the bar graph (1 - 16).
+ *
+ * @param value The value to be displayed.
+ *
+ * @param full_scale The value that fills every cell of the bar graph.
+ *
+ * @return None
+ */
+void EduBase_LCD_Bar_Graph_Write(uint8_t col, uint8_t row, uint8_t width, uint32_t value, uint32_t full_scale);
+
+/**
+ * @brief Displays a horizontal bar graph.
+ *
+ * The bar graph is written to the framebuffer with EduBase_LCD_Bar_Graph_Write, and the framebuffer
+ * is flushed, so only the cells that have changed are transmitted to the LCD.
+ *
+ * @param col The leftmost column of the bar graph (0 - 15).
+ *
+ * @param row The row of the bar graph (0 - 1).
+ *
+ * @param width The number of cells of the bar graph (1 - 16).
+ *
+ * @param value The value to be displayed.
+ *
+ * @param full_scale The value that fills every cell of the bar graph.
+ *
+ * @return None
+ */
+void EduBase_LCD_Bar_Graph_Display(uint8_t col, uint8_t row, uint8_t width, uint32_t value, uint32_t full_scale);
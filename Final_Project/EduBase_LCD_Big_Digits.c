@@ -0,0 +1,139 @@
+/**
+ * @file EduBase_LCD_Big_Digits.c
+ *
+ * @brief Source code for the EduBase_LCD_Big_Digits driver.
+ *
+ * This file contains the function definitions for the EduBase_LCD_Big_Digits driver.
+ * It draws large digits with three custom segment glyphs and the full block character.
+ *
+ * @author Aaron Nanas
+ */
+
+#include "EduBase_LCD_Big_Digits.h"
+
+// Cells used to draw the large digits
+#define BIG_CELL_BLANK          0
+#define BIG_CELL_UPPER          1
+#define BIG_CELL_LOWER          2
+#define BIG_CELL_UPPER_LOWER    3
+#define BIG_CELL_FULL           4
+
+// Character of the LCD character ROM (A00) with every dot on
+#define FULL_BLOCK_CHARACTER    0xFF
+
+// Cells of each digit: the three cells of the top row followed by the three cells of the bottom row
+// The middle stroke is drawn by the lower bars of the top row
+static const uint8_t big_digit_cells[10][BIG_DIGIT_WIDTH * BIG_DIGIT_HEIGHT] =
+{
+	// 0
+	{BIG_CELL_FULL, BIG_CELL_UPPER, BIG_CELL_FULL,
+	 BIG_CELL_FULL, BIG_CELL_LOWER, BIG_CELL_FULL},
+
+	// 1
+	{BIG_CELL_UPPER, BIG_CELL_FULL, BIG_CELL_BLANK,
+	 BIG_CELL_LOWER, BIG_CELL_FULL, BIG_CELL_LOWER},
+
+	// 2
+	{BIG_CELL_UPPER_LOWER, BIG_CELL_UPPER_LOWER, BIG_CELL_FULL,
+	 BIG_CELL_FULL, BIG_CELL_LOWER, BIG_CELL_LOWER},
+
+	// 3
+	{BIG_CELL_UPPER_LOWER, BIG_CELL_UPPER_LOWER, BIG_CELL_FULL,
+	 BIG_CELL_LOWER, BIG_CELL_LOWER, BIG_CELL_FULL},
+
+	// 4
+	{BIG_CELL_FULL, BIG_CELL_LOWER, BIG_CELL_FULL,
+	 BIG_CELL_BLANK, BIG_CELL_BLANK, BIG_CELL_FULL},
+
+	// 5
+	{BIG_CELL_FULL, BIG_CELL_UPPER_LOWER, BIG_CELL_UPPER_LOWER,
+	 BIG_CELL_LOWER, BIG_CELL_LOWER, BIG_CELL_FULL},
+
+	// 6
+	{BIG_CELL_FULL, BIG_CELL_UPPER_LOWER, BIG_CELL_UPPER_LOWER,
+	 BIG_CELL_FULL, BIG_CELL_LOWER, BIG_CELL_FULL},
+
+	// 7
+	{BIG_CELL_UPPER, BIG_CELL_UPPER, BIG_CELL_FULL,
+	 BIG_CELL_BLANK, BIG_CELL_BLANK, BIG_CELL_FULL},
+
+	// 8
+	{BIG_CELL_FULL, BIG_CELL_UPPER_LOWER, BIG_CELL_FULL,
+	 BIG_CELL_FULL, BIG_CELL_LOWER, BIG_CELL_FULL},
+
+	// 9
+	{BIG_CELL_FULL, BIG_CELL_UPPER_LOWER, BIG_CELL_FULL,
+	 BIG_CELL_LOWER, BIG_CELL_LOWER, BIG_CELL_FULL}
+};
+
+static void EduBase_LCD_Big_Digits_Write_Cell(uint8_t col, uint8_t row, uint8_t cell)
+{
+	switch (cell)
+	{
+		case BIG_CELL_UPPER:
+		{
+			EduBase_LCD_Buffer_Write_Glyph(col, row, GLYPH_BIG_UPPER);
+		}
+		break;
+
+		case BIG_CELL_LOWER:
+		{
+			EduBase_LCD_Buffer_Write_Glyph(col, row, GLYPH_BIG_LOWER);
+		}
+		break;
+
+		case BIG_CELL_UPPER_LOWER:
+		{
+			EduBase_LCD_Buffer_Write_Glyph(col, row, GLYPH_BIG_UPPER_LOWER);
+		}
+		break;
+
+		case BIG_CELL_FULL:
+		{
+			EduBase_LCD_Buffer_Write_Character(col, row, FULL_BLOCK_CHARACTER);
+		}
+		break;
+
+		default:
+		{
+			EduBase_LCD_Buffer_Write_Character(col, row, ' ');
+		}
+		break;
+	}
+}
+
+void EduBase_LCD_Big_Digits_Write(uint8_t col, uint8_t digit)
+{
+	for (uint8_t row = 0; row < BIG_DIGIT_HEIGHT; row++)
+	{
+		for (uint8_t i = 0; i < BIG_DIGIT_WIDTH; i++)
+		{
+			uint8_t cell = (digit < 10) ? big_digit_cells[digit][(row * BIG_DIGIT_WIDTH) + i] : BIG_CELL_BLANK;
+			EduBase_LCD_Big_Digits_Write_Cell(col + i, row, cell);
+		}
+	}
+}
+
+void EduBase_LCD_Big_Digits_Display(uint32_t value, uint8_t col, uint8_t num_digits)
+{
+	if (num_digits > BIG_DIGIT_MAX_DIGITS)
+	{
+		num_digits = BIG_DIGIT_MAX_DIGITS;
+	}
+
+	// Convert the value to packed BCD digits without hardware divides
+	uint64_t bcd = Format_BCD(value);
+	uint8_t length = Format_BCD_Digit_Count(bcd);
+
+	// Write the digits from the rightmost one, and blank the leading digits of the field
+	for (uint8_t i = 0; i < num_digits; i++)
+	{
+		uint8_t digit = (i < length) ? FORMAT_BCD_DIGIT(bcd, i) : BIG_DIGIT_BLANK;
+		uint8_t digit_col = col + ((num_digits - 1 - i) * (BIG_DIGIT_WIDTH + BIG_DIGIT_SPACING));
+
+		EduBase_LCD_Big_Digits_Write(digit_col, digit);
+	}
+
+	// Transmit the cells that have changed
+	EduBase_LCD_Buffer_Flush();
+}
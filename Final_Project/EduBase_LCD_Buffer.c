@@ -0,0 +1,269 @@
+/**
+ * @file EduBase_LCD_Buffer.c
+ *
+ * @brief Source code for the EduBase_LCD_Buffer driver.
+ *
+ * This file contains the function definitions for the EduBase_LCD_Buffer driver.
+ * It provides virtual 16x2 screens (framebuffers) for the EduBase Board 16x2 Liquid Crystal Display (LCD)
+ * and mirrors the active screen to the LCD.
+ *
+ * @author Aaron Nanas
+ */
+
+#include "EduBase_LCD_Buffer.h"
+
+// Characters of each virtual screen
+static char frame_buffer[EDUBASE_LCD_SCREENS][EDUBASE_LCD_ROWS][EDUBASE_LCD_COLUMNS];
+
+// Glyph IDs of the cells of each virtual screen, or EDUBASE_LCD_NO_GLYPH for the cells that hold a regular character
+static uint8_t frame_glyphs[EDUBASE_LCD_SCREENS][EDUBASE_LCD_ROWS][EDUBASE_LCD_COLUMNS];
+
+// Screen that is modified by the write functions, and screen that is mirrored to the LCD
+static uint8_t draw_screen = 0;
+static uint8_t active_screen = 0;
+
+// Characters that are currently displayed on the LCD
+static char lcd_contents[EDUBASE_LCD_ROWS][EDUBASE_LCD_COLUMNS];
+
+// Indicates whether lcd_contents matches the LCD
+static uint8_t lcd_contents_valid = 0;
+
+// Indicates whether a glyph of the framebuffer was not in CGRAM during the first pass of a flush
+static uint8_t glyph_missed = 0;
+
+void EduBase_LCD_Buffer_Init(void)
+{
+	memset(frame_buffer, ' ', sizeof(frame_buffer));
+	memset(frame_glyphs, EDUBASE_LCD_NO_GLYPH, sizeof(frame_glyphs));
+
+	draw_screen = 0;
+	active_screen = 0;
+
+	EduBase_LCD_Buffer_Notify_Clear();
+}
+
+void EduBase_LCD_Buffer_Clear(void)
+{
+	memset(frame_buffer[draw_screen], ' ', sizeof(frame_buffer[draw_screen]));
+	memset(frame_glyphs[draw_screen], EDUBASE_LCD_NO_GLYPH, sizeof(frame_glyphs[draw_screen]));
+}
+
+void EduBase_LCD_Buffer_Write_Character(uint8_t col, uint8_t row, char character)
+{
+	if ((col < EDUBASE_LCD_COLUMNS) && (row < EDUBASE_LCD_ROWS))
+	{
+		frame_buffer[draw_screen][row][col] = character;
+		frame_glyphs[draw_screen][row][col] = EDUBASE_LCD_NO_GLYPH;
+	}
+}
+
+void EduBase_LCD_Buffer_Write_Glyph(uint8_t col, uint8_t row, uint8_t glyph)
+{
+	if ((col < EDUBASE_LCD_COLUMNS) && (row < EDUBASE_LCD_ROWS))
+	{
+		frame_buffer[draw_screen][row][col] = ' ';
+		frame_glyphs[draw_screen][row][col] = glyph;
+	}
+}
+
+void EduBase_LCD_Buffer_Write_String(uint8_t col, uint8_t row, const char *string)
+{
+	if (row >= EDUBASE_LCD_ROWS)
+	{
+		return;
+	}
+
+	while ((col < EDUBASE_LCD_COLUMNS) && (*string != '\0'))
+	{
+		frame_glyphs[draw_screen][row][col] = EDUBASE_LCD_NO_GLYPH;
+		frame_buffer[draw_screen][row][col++] = *string++;
+	}
+}
+
+void EduBase_LCD_Buffer_Print_Text(const char *message_1, const char *message_2)
+{
+	EduBase_LCD_Buffer_Clear();
+	EduBase_LCD_Buffer_Write_String(0, 0, message_1);
+	EduBase_LCD_Buffer_Write_String(0, 1, message_2);
+}
+
+void EduBase_LCD_Buffer_Scroll_Left(void)
+{
+	for (uint8_t row = 0; row < EDUBASE_LCD_ROWS; row++)
+	{
+		char first_character = frame_buffer[draw_screen][row][0];
+		uint8_t first_glyph = frame_glyphs[draw_screen][row][0];
+
+		memmove(&frame_buffer[draw_screen][row][0], &frame_buffer[draw_screen][row][1], EDUBASE_LCD_COLUMNS - 1);
+		memmove(&frame_glyphs[draw_screen][row][0], &frame_glyphs[draw_screen][row][1], EDUBASE_LCD_COLUMNS - 1);
+
+		frame_buffer[draw_screen][row][EDUBASE_LCD_COLUMNS - 1] = first_character;
+		frame_glyphs[draw_screen][row][EDUBASE_LCD_COLUMNS - 1] = first_glyph;
+	}
+}
+
+void EduBase_LCD_Buffer_Scroll_Right(void)
+{
+	for (uint8_t row = 0; row < EDUBASE_LCD_ROWS; row++)
+	{
+		char last_character = frame_buffer[draw_screen][row][EDUBASE_LCD_COLUMNS - 1];
+		uint8_t last_glyph = frame_glyphs[draw_screen][row][EDUBASE_LCD_COLUMNS - 1];
+
+		memmove(&frame_buffer[draw_screen][row][1], &frame_buffer[draw_screen][row][0], EDUBASE_LCD_COLUMNS - 1);
+		memmove(&frame_glyphs[draw_screen][row][1], &frame_glyphs[draw_screen][row][0], EDUBASE_LCD_COLUMNS - 1);
+
+		frame_buffer[draw_screen][row][0] = last_character;
+		frame_glyphs[draw_screen][row][0] = last_glyph;
+	}
+}
+
+static uint8_t EduBase_LCD_Buffer_Flush_Pass(uint8_t final_pass)
+{
+	uint8_t characters_sent = 0;
+
+	for (uint8_t row = 0; row < EDUBASE_LCD_ROWS; row++)
+	{
+		// Indicates whether the address counter of the LCD points to the current cell
+		uint8_t cursor_in_place = 0;
+
+		for (uint8_t col = 0; col < EDUBASE_LCD_COLUMNS; col++)
+		{
+			char character = frame_buffer[active_screen][row][col];
+
+			// Replace the glyph with the CGRAM slot that holds it
+			if (frame_glyphs[active_screen][row][col] != EDUBASE_LCD_NO_GLYPH)
+			{
+				uint8_t slot = EduBase_LCD_Glyph_Find(frame_glyphs[active_screen][row][col]);
+
+				if (slot != EDUBASE_LCD_GLYPH_NO_SLOT)
+				{
+					character = slot;
+				}
+				else if (!final_pass && ((uint8_t)lcd_contents[row][col] >= EDUBASE_LCD_GLYPH_SLOTS))
+				{
+					// Write the cell after the glyph has been uploaded
+					glyph_missed = 1;
+					cursor_in_place = 0;
+					continue;
+				}
+				else
+				{
+					// Blank the cell so that the slot it refers to can be replaced,
+					// or when every slot is in use during the final pass
+					glyph_missed = 1;
+				}
+			}
+
+			if (character == lcd_contents[row][col])
+			{
+				cursor_in_place = 0;
+				continue;
+			}
+
+			// Move the cursor at the start of each run of changed cells
+			if (!cursor_in_place)
+			{
+				EduBase_LCD_Set_Cursor(col, row);
+				cursor_in_place = 1;
+			}
+
+			EduBase_LCD_Send_Data(character);
+			EduBase_LCD_Glyph_Update_Reference(lcd_contents[row][col], character);
+			lcd_contents[row][col] = character;
+			characters_sent++;
+		}
+	}
+
+	return characters_sent;
+}
+
+static uint8_t EduBase_LCD_Buffer_Flush_Active_Screen(void)
+{
+	// Clear the display if its contents are unknown
+	if (!lcd_contents_valid)
+	{
+		EduBase_LCD_Clear_Display();
+	}
+
+	// The glyphs resolved during this flush cannot be evicted by each other
+	EduBase_LCD_Glyph_Start_Frame();
+
+	// Transmit the regular characters and the glyphs that are already in CGRAM
+	glyph_missed = 0;
+	uint8_t characters_sent = EduBase_LCD_Buffer_Flush_Pass(0);
+
+	if (glyph_missed)
+	{
+		// Upload the missing glyphs now that the cells that referred to the replaced slots have been overwritten
+		for (uint8_t row = 0; row < EDUBASE_LCD_ROWS; row++)
+		{
+			for (uint8_t col = 0; col < EDUBASE_LCD_COLUMNS; col++)
+			{
+				if (frame_glyphs[active_screen][row][col] != EDUBASE_LCD_NO_GLYPH)
+				{
+					EduBase_LCD_Glyph_Acquire(frame_glyphs[active_screen][row][col]);
+				}
+			}
+		}
+
+		characters_sent += EduBase_LCD_Buffer_Flush_Pass(1);
+	}
+
+	return characters_sent;
+}
+
+uint8_t EduBase_LCD_Buffer_Flush(void)
+{
+	// A screen in the background is only transmitted when it becomes the active screen
+	if (draw_screen != active_screen)
+	{
+		return 0;
+	}
+
+	return EduBase_LCD_Buffer_Flush_Active_Screen();
+}
+
+uint8_t EduBase_LCD_Buffer_Select_Screen(uint8_t screen)
+{
+	uint8_t previous_screen = draw_screen;
+
+	if (screen < EDUBASE_LCD_SCREENS)
+	{
+		draw_screen = screen;
+	}
+
+	return previous_screen;
+}
+
+void EduBase_LCD_Buffer_Show_Screen(uint8_t screen)
+{
+	if (screen < EDUBASE_LCD_SCREENS)
+	{
+		active_screen = screen;
+	}
+
+	// Transmit the cells of the new screen that differ from the previous one
+	EduBase_LCD_Buffer_Flush_Active_Screen();
+}
+
+uint8_t EduBase_LCD_Buffer_Get_Selected_Screen(void)
+{
+	return draw_screen;
+}
+
+uint8_t EduBase_LCD_Buffer_Get_Active_Screen(void)
+{
+	return active_screen;
+}
+
+void EduBase_LCD_Buffer_Invalidate(void)
+{
+	lcd_contents_valid = 0;
+}
+
+void EduBase_LCD_Buffer_Notify_Clear(void)
+{
+	memset(lcd_contents, ' ', sizeof(lcd_contents));
+	lcd_contents_valid = 1;
+	EduBase_LCD_Glyph_Clear_References();
+}
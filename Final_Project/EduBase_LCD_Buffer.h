@@ -0,0 +1,224 @@
+/**
+ * @file EduBase_LCD_Buffer.h
+ *
+ * @brief Header file for the EduBase_LCD_Buffer driver.
+ *
+ * This file contains the function definitions for the EduBase_LCD_Buffer driver.
+ * It provides virtual 16x2 screens (framebuffers) for the EduBase Board 16x2 Liquid Crystal Display (LCD).
+ *
+ * The text is written to the framebuffer in RAM, which does not access the LCD.
+ * EduBase_LCD_Buffer_Flush then compares the framebuffer with a copy of the characters
+ * that are shown on the LCD and only transmits the cells that have changed.
+ * Each run of contiguous changed cells is preceded by a single Set DDRAM Address command,
+ * since the address counter of the LCD is incremented after each character.
+ * When nothing has changed, a flush does not access the LCD at all.
+ *
+ * The driver holds EDUBASE_LCD_SCREENS virtual screens, each with its own framebuffer, so that
+ * several applications can display text independently. The write functions modify the screen that
+ * is selected with EduBase_LCD_Buffer_Select_Screen, and only the active screen is mirrored to the LCD.
+ * An application in the background keeps updating its screen in RAM without accessing the LCD,
+ * since flushing a screen that is not active does nothing. EduBase_LCD_Buffer_Show_Screen makes
+ * another screen active and only transmits the cells that differ between the two screens,
+ * so switching screens does not redraw the display from scratch.
+ *
+ * Custom characters are written to the framebuffer as glyph IDs (see EduBase_LCD_Glyph.h).
+ * A flush first transmits the cells whose glyphs are already in CGRAM, then uploads
+ * the missing glyphs, and then transmits the remaining cells.
+ *
+ * @note The functions of the EduBase_LCD driver that clear or shift the display keep the copy
+ * of the LCD contents up to date. Code that writes characters to the LCD without using the
+ * framebuffer must call EduBase_LCD_Buffer_Invalidate afterwards.
+ *
+ * @author Aaron Nanas
+ */
+
+#ifndef EDUBASE_LCD_BUFFER_H
+#define EDUBASE_LCD_BUFFER_H
+
+#include "TM4C123GH6PM.h"
+#include "EduBase_LCD.h"
+#include "EduBase_LCD_Glyph.h"
+
+// Dimensions of the LCD
+#define EDUBASE_LCD_COLUMNS     16
+#define EDUBASE_LCD_ROWS        2
+
+// Number of virtual screens
+#define EDUBASE_LCD_SCREENS     4
+
+/**
+ * @brief Initializes the virtual screens.
+ *
+ * This function fills the framebuffer of every screen with spaces and marks the whole LCD as blank.
+ * Screen 0 is selected and active. It is called by EduBase_LCD_Init after the display has been cleared.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void EduBase_LCD_Buffer_Init(void);
+
+/**
+ * @brief Fills the framebuffer of the selected screen with spaces.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void EduBase_LCD_Buffer_Clear(void);
+
+/**
+ * @brief Writes a character to a cell of the framebuffer of the selected screen.
+ *
+ * @param col The column of the cell (0 - 15).
+ *
+ * @param row The row of the cell (0 - 1).
+ *
+ * @param character The character to be written.
+ *
+ * @return None
+ */
+void EduBase_LCD_Buffer_Write_Character(uint8_t col, uint8_t row, char character);
+
+/**
+ * @brief Writes a custom character to a cell of the framebuffer of the selected screen.
+ *
+ * The glyph is uploaded to CGRAM during the next flush if it is not already there.
+ * If a frame uses more than eight different glyphs, the glyphs that do not fit are displayed as spaces.
+ *
+ * @param col The column of the cell (0 - 15).
+ *
+ * @param row The row of the cell (0 - 1).
+ *
+ * @param glyph The ID of the glyph (see the Glyph_IDs enum).
+ *
+ * @return None
+ */
+void EduBase_LCD_Buffer_Write_Glyph(uint8_t col, uint8_t row, uint8_t glyph);
+
+/**
+ * @brief Writes a string to the framebuffer of the selected screen.
+ *
+ * The string is written from the specified cell to the end of the row.
+ * The characters that do not fit in the row are ignored.
+ *
+ * @param col The column of the first character (0 - 15).
+ *
+ * @param row The row of the string (0 - 1).
+ *
+ * @param string The null-terminated string to be written.
+ *
+ * @return None
+ */
+void EduBase_LCD_Buffer_Write_String(uint8_t col, uint8_t row, const char *string);
+
+/**
+ * @brief Replaces both rows of the framebuffer of the selected screen with two lines of text.
+ *
+ * Each line is written from the first column and the rest of the row is filled with spaces.
+ *
+ * @param message_1 The null-terminated string to be written to the first row.
+ *
+ * @param message_2 The null-terminated string to be written to the second row.
+ *
+ * @return None
+ */
+void EduBase_LCD_Buffer_Print_Text(const char *message_1, const char *message_2);
+
+/**
+ * @brief Rotates both rows of the framebuffer of the selected screen one position to the left.
+ *
+ * The character in the first column moves to the last column.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void EduBase_LCD_Buffer_Scroll_Left(void);
+
+/**
+ * @brief Rotates both rows of the framebuffer of the selected screen one position to the right.
+ *
+ * The character in the last column moves to the first column.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void EduBase_LCD_Buffer_Scroll_Right(void);
+
+/**
+ * @brief Transmits the cells of the framebuffer that differ from the LCD contents.
+ *
+ * Nothing is transmitted when the selected screen is not the active screen.
+ * If the LCD contents are unknown (see EduBase_LCD_Buffer_Invalidate), the display is cleared first.
+ *
+ * @param None
+ *
+ * @return The number of characters that have been transmitted to the LCD.
+ */
+uint8_t EduBase_LCD_Buffer_Flush(void);
+
+/**
+ * @brief Selects the screen that is modified by the write functions.
+ *
+ * Each application selects its screen before it writes to the framebuffer.
+ *
+ * @param screen The screen to be selected (0 - EDUBASE_LCD_SCREENS - 1).
+ *
+ * @return The screen that was selected before the call, so that it can be restored.
+ */
+uint8_t EduBase_LCD_Buffer_Select_Screen(uint8_t screen);
+
+/**
+ * @brief Returns the screen that is modified by the write functions.
+ *
+ * @param None
+ *
+ * @return The selected screen (0 - EDUBASE_LCD_SCREENS - 1).
+ */
+uint8_t EduBase_LCD_Buffer_Get_Selected_Screen(void);
+
+/**
+ * @brief Makes a screen active and mirrors it to the LCD.
+ *
+ * Only the cells of the new active screen that differ from the LCD contents are transmitted.
+ *
+ * @param screen The screen to be displayed (0 - EDUBASE_LCD_SCREENS - 1).
+ *
+ * @return None
+ */
+void EduBase_LCD_Buffer_Show_Screen(uint8_t screen);
+
+/**
+ * @brief Returns the screen that is mirrored to the LCD.
+ *
+ * @param None
+ *
+ * @return The active screen (0 - EDUBASE_LCD_SCREENS - 1).
+ */
+uint8_t EduBase_LCD_Buffer_Get_Active_Screen(void);
+
+/**
+ * @brief Marks the LCD contents as unknown.
+ *
+ * The next flush clears the display and transmits every cell of the framebuffer that is not a space.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void EduBase_LCD_Buffer_Invalidate(void);
+
+/**
+ * @brief Records that the display has been cleared with the Clear Display command.
+ *
+ * This function is called by EduBase_LCD_Clear_Display.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void EduBase_LCD_Buffer_Notify_Clear(void);
+
+#endif
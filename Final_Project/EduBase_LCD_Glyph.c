@@ -0,0 +1,184 @@
+/**
+ * @file EduBase_LCD_Glyph.c
+ *
+ * @brief Source code for the EduBase_LCD_Glyph driver.
+ *
+ * This file contains the function definitions for the EduBase_LCD_Glyph driver.
+ * It caches the custom characters (glyphs) in the eight CGRAM slots of the EduBase Board 16x2 LCD
+ * and replaces the least recently used slot on a miss.
+ *
+ * @author Aaron Nanas
+ */
+
+#include "EduBase_LCD_Glyph.h"
+
+// Patterns of the glyphs (5x8 dots), indexed by the Glyph_IDs enum
+static const uint8_t glyph_patterns[GLYPH_COUNT][8] =
+{
+	// GLYPH_UP_ARROW
+	{0x00, 0x04, 0x0E, 0x15, 0x04, 0x04, 0x04, 0x04},
+
+	// GLYPH_DOWN_ARROW
+	{0x04, 0x04, 0x04, 0x04, 0x04, 0x15, 0x0E, 0x04},
+
+	// GLYPH_LEFT_ARROW
+	{0x00, 0x04, 0x08, 0x1F, 0x08, 0x04, 0x00, 0x00},
+
+	// GLYPH_RIGHT_ARROW
+	{0x00, 0x04, 0x02, 0x1F, 0x02, 0x04, 0x00, 0x00},
+
+	// GLYPH_HEART_SHAPE
+	{0x00, 0x00, 0x0A, 0x1F, 0x1F, 0x0E, 0x04, 0x00},
+
+	// GLYPH_BIG_UPPER (segment of the large digits)
+	{0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+
+	// GLYPH_BIG_LOWER (segment of the large digits)
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F},
+
+	// GLYPH_BIG_UPPER_LOWER (segment of the large digits)
+	{0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F},
+
+	// GLYPH_BAR_1 (partial block of the bar graphs with the leftmost column filled)
+	{0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10},
+
+	// GLYPH_BAR_2 (partial block of the bar graphs with the two leftmost columns filled)
+	{0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+
+	// GLYPH_BAR_3 (partial block of the bar graphs with the three leftmost columns filled)
+	{0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C},
+
+	// GLYPH_BAR_4 (partial block of the bar graphs with the four leftmost columns filled)
+	{0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E}
+};
+
+// Slot that holds each glyph, and glyph that is held by each slot
+static uint8_t glyph_slots[GLYPH_COUNT];
+static uint8_t slot_glyphs[EDUBASE_LCD_GLYPH_SLOTS];
+
+// Number of LCD cells that refer to each slot
+static uint8_t slot_references[EDUBASE_LCD_GLYPH_SLOTS];
+
+// Value of use_counter when each slot was last used
+static uint32_t slot_last_use[EDUBASE_LCD_GLYPH_SLOTS];
+
+// Incremented each time a slot is used, and its value at the start of the current frame
+static uint32_t use_counter = 0;
+static uint32_t frame_start = 0;
+
+void EduBase_LCD_Glyph_Init(void)
+{
+	for (uint8_t glyph = 0; glyph < GLYPH_COUNT; glyph++)
+	{
+		glyph_slots[glyph] = EDUBASE_LCD_GLYPH_NO_SLOT;
+	}
+
+	for (uint8_t slot = 0; slot < EDUBASE_LCD_GLYPH_SLOTS; slot++)
+	{
+		slot_glyphs[slot] = EDUBASE_LCD_NO_GLYPH;
+		slot_references[slot] = 0;
+		slot_last_use[slot] = 0;
+	}
+
+	use_counter = 0;
+	frame_start = 0;
+}
+
+void EduBase_LCD_Glyph_Start_Frame(void)
+{
+	frame_start = ++use_counter;
+}
+
+uint8_t EduBase_LCD_Glyph_Find(uint8_t glyph)
+{
+	if (glyph >= GLYPH_COUNT)
+	{
+		return EDUBASE_LCD_GLYPH_NO_SLOT;
+	}
+
+	uint8_t slot = glyph_slots[glyph];
+
+	if (slot != EDUBASE_LCD_GLYPH_NO_SLOT)
+	{
+		slot_last_use[slot] = ++use_counter;
+	}
+
+	return slot;
+}
+
+uint8_t EduBase_LCD_Glyph_Acquire(uint8_t glyph)
+{
+	if (glyph >= GLYPH_COUNT)
+	{
+		return EDUBASE_LCD_GLYPH_NO_SLOT;
+	}
+
+	uint8_t slot = EduBase_LCD_Glyph_Find(glyph);
+
+	if (slot != EDUBASE_LCD_GLYPH_NO_SLOT)
+	{
+		return slot;
+	}
+
+	for (uint8_t i = 0; i < EDUBASE_LCD_GLYPH_SLOTS; i++)
+	{
+		// Use an empty slot immediately
+		if (slot_glyphs[i] == EDUBASE_LCD_NO_GLYPH)
+		{
+			slot = i;
+			break;
+		}
+
+		// Skip the slots that are displayed on the LCD or used in the current frame
+		if ((slot_references[i] != 0) || (slot_last_use[i] >= frame_start))
+		{
+			continue;
+		}
+
+		// Select the least recently used slot
+		if ((slot == EDUBASE_LCD_GLYPH_NO_SLOT) || (slot_last_use[i] < slot_last_use[slot]))
+		{
+			slot = i;
+		}
+	}
+
+	if (slot == EDUBASE_LCD_GLYPH_NO_SLOT)
+	{
+		return EDUBASE_LCD_GLYPH_NO_SLOT;
+	}
+
+	// Evict the glyph that was held by the slot
+	if (slot_glyphs[slot] != EDUBASE_LCD_NO_GLYPH)
+	{
+		glyph_slots[slot_glyphs[slot]] = EDUBASE_LCD_GLYPH_NO_SLOT;
+	}
+
+	EduBase_LCD_Create_Custom_Character(slot, glyph_patterns[glyph]);
+
+	glyph_slots[glyph] = slot;
+	slot_glyphs[slot] = glyph;
+	slot_last_use[slot] = ++use_counter;
+
+	return slot;
+}
+
+void EduBase_LCD_Glyph_Update_Reference(char old_character, char new_character)
+{
+	if ((uint8_t)old_character < EDUBASE_LCD_GLYPH_SLOTS)
+	{
+		slot_references[(uint8_t)old_character]--;
+	}
+
+	if ((uint8_t)new_character < EDUBASE_LCD_GLYPH_SLOTS)
+	{
+		slot_references[(uint8_t)new_character]++;
+	}
+}
+
+void EduBase_LCD_Glyph_Clear_References(void)
+{
+	for (uint8_t slot = 0; slot < EDUBASE_LCD_GLYPH_SLOTS; slot++)
+	{
+		slot_references[slot] = 0;
+	}
+}
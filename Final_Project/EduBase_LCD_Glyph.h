@@ -0,0 +1,122 @@
+/**
+ * @file EduBase_LCD_Glyph.h
+ *
+ * @brief Header file for the EduBase_LCD_Glyph driver.
+ *
+ * This file contains the function definitions for the EduBase_LCD_Glyph driver.
+ * It manages the eight Character Generator RAM (CGRAM) slots of the EduBase Board 16x2 LCD
+ * as a cache of custom characters (glyphs).
+ *
+ * Each glyph has a logical ID from the Glyph_IDs enum, and its pattern is stored in flash.
+ * EduBase_LCD_Glyph_Acquire returns the CGRAM slot that holds a glyph. The pattern is only
+ * uploaded to the LCD when the glyph is not already in CGRAM. On a miss, the least recently
+ * used slot is replaced, but a slot is never replaced while a character on the LCD refers to it
+ * or while it is used by the frame that is being drawn, so the visible characters are not corrupted.
+ * Screens can therefore use more than eight glyphs over time.
+ *
+ * The EduBase_LCD_Buffer driver keeps the number of LCD cells that refer to each slot up to date,
+ * and it resolves the glyphs written with EduBase_LCD_Buffer_Write_Glyph when it is flushed.
+ *
+ * @author Aaron Nanas
+ */
+
+#ifndef EDUBASE_LCD_GLYPH_H
+#define EDUBASE_LCD_GLYPH_H
+
+#include "TM4C123GH6PM.h"
+#include "EduBase_LCD.h"
+
+// Number of CGRAM slots of the LCD (5x8 dots)
+#define EDUBASE_LCD_GLYPH_SLOTS         8
+
+// Returned by EduBase_LCD_Glyph_Find and EduBase_LCD_Glyph_Acquire when the glyph has no slot
+#define EDUBASE_LCD_GLYPH_NO_SLOT       0xFF
+
+// Marks a slot that does not hold a glyph, or a framebuffer cell that holds a regular character
+#define EDUBASE_LCD_NO_GLYPH            0xFF
+
+enum Glyph_IDs
+{
+	GLYPH_UP_ARROW          = 0x00,
+	GLYPH_DOWN_ARROW        = 0x01,
+	GLYPH_LEFT_ARROW        = 0x02,
+	GLYPH_RIGHT_ARROW       = 0x03,
+	GLYPH_HEART_SHAPE       = 0x04,
+	GLYPH_BIG_UPPER         = 0x05,
+	GLYPH_BIG_LOWER         = 0x06,
+	GLYPH_BIG_UPPER_LOWER   = 0x07,
+	GLYPH_BAR_1             = 0x08,
+	GLYPH_BAR_2             = 0x09,
+	GLYPH_BAR_3             = 0x0A,
+	GLYPH_BAR_4             = 0x0B,
+	GLYPH_COUNT
+};
+
+/**
+ * @brief Marks every CGRAM slot as empty.
+ *
+ * It is called by EduBase_LCD_Init, since the contents of the CGRAM are undefined after power-on.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void EduBase_LCD_Glyph_Init(void);
+
+/**
+ * @brief Starts a new frame.
+ *
+ * The slots used by EduBase_LCD_Glyph_Find or EduBase_LCD_Glyph_Acquire after this call
+ * are not replaced until the next call.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void EduBase_LCD_Glyph_Start_Frame(void);
+
+/**
+ * @brief Returns the CGRAM slot that holds a glyph without uploading it.
+ *
+ * @param glyph The ID of the glyph.
+ *
+ * @return The slot (0 - 7) that holds the glyph, or EDUBASE_LCD_GLYPH_NO_SLOT if the glyph is not in CGRAM.
+ */
+uint8_t EduBase_LCD_Glyph_Find(uint8_t glyph);
+
+/**
+ * @brief Returns the CGRAM slot that holds a glyph, and uploads the glyph on a miss.
+ *
+ * The pattern is written to the least recently used slot that is not referred to by the LCD
+ * and has not been used in the current frame.
+ *
+ * @param glyph The ID of the glyph.
+ *
+ * @return The slot (0 - 7) that holds the glyph, or EDUBASE_LCD_GLYPH_NO_SLOT if every slot is in use.
+ *
+ * @note An upload moves the address counter of the LCD to the CGRAM, so the cursor must be set again
+ * before characters are written.
+ */
+uint8_t EduBase_LCD_Glyph_Acquire(uint8_t glyph);
+
+/**
+ * @brief Updates the number of LCD cells that refer to each slot when a cell is overwritten.
+ *
+ * @param old_character The character that was displayed in the cell.
+ *
+ * @param new_character The character that is displayed in the cell.
+ *
+ * @return None
+ */
+void EduBase_LCD_Glyph_Update_Reference(char old_character, char new_character);
+
+/**
+ * @brief Records that no LCD cell refers to a slot, after the display has been cleared.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void EduBase_LCD_Glyph_Clear_References(void);
+
+#endif
@@ -0,0 +1,168 @@
+/**
+ * @file Format.c
+ *
+ * @brief Source code for the Format driver.
+ *
+ * This file contains the function definitions for the Format driver.
+ * It converts integers, Q16.16 fixed-point values, and hexadecimal values to strings without sprintf,
+ * and converts integers to packed BCD digits.
+ *
+ * @author Aaron Nanas
+ */
+
+#include "Format.h"
+
+// Powers of ten used to scale the fraction of a Q16.16 value
+static const uint32_t powers_of_ten[FORMAT_MAX_DECIMALS + 1] =
+{
+	1,
+	10,
+	100,
+	1000,
+	10000,
+	100000,
+	1000000,
+	10000000,
+	100000000,
+	1000000000
+};
+
+static uint8_t Format_Digits(char *buffer, uint32_t value, uint8_t min_digits)
+{
+	char digits[10];
+	uint8_t length = 0;
+
+	// Extract the digits from the least significant one
+	do
+	{
+		uint32_t quotient = Format_Divide_By_10(value);
+		digits[length++] = (value - (quotient * 10)) + '0';
+		value = quotient;
+	}
+	while ((value != 0) || (length < min_digits));
+
+	// Copy the digits to the buffer from the most significant one
+	for (uint8_t i = 0; i < length; i++)
+	{
+		buffer[i] = digits[length - 1 - i];
+	}
+
+	buffer[length] = '\0';
+
+	return length;
+}
+
+uint32_t Format_Divide_By_10(uint32_t value)
+{
+	// 0xCCCCCCCD = ceil(2^35 / 10), which gives the exact quotient for every 32-bit value
+	return (uint32_t)(((uint64_t)value * 0xCCCCCCCDU) >> 35);
+}
+
+uint64_t Format_BCD(uint32_t value)
+{
+	uint64_t bcd = 0;
+
+	// Extract every digit, even when the remaining value is zero,
+	// so the number of multiplications is the same for every value
+	for (uint8_t i = 0; i < FORMAT_BCD_DIGITS; i++)
+	{
+		uint32_t quotient = Format_Divide_By_10(value);
+		bcd |= (uint64_t)(value - (quotient * 10)) << (4 * i);
+		value = quotient;
+	}
+
+	return bcd;
+}
+
+uint8_t Format_BCD_Digit_Count(uint64_t bcd)
+{
+	uint32_t upper_digits = (uint32_t)(bcd >> 32);
+	uint32_t lower_digits = (uint32_t)bcd;
+
+	// Find the position of the most significant bit that is set (__CLZ returns 32 for zero)
+	uint8_t significant_bits = (upper_digits != 0) ? (64 - __CLZ(upper_digits)) : (32 - __CLZ(lower_digits));
+
+	// Round up to whole digits, and count at least one digit for zero
+	uint8_t num_digits = (significant_bits + 3) >> 2;
+
+	return (num_digits != 0) ? num_digits : 1;
+}
+
+uint8_t Format_Unsigned_Decimal(char *buffer, uint32_t value)
+{
+	return Format_Digits(buffer, value, 1);
+}
+
+uint8_t Format_Signed_Decimal(char *buffer, int32_t value)
+{
+	if (value < 0)
+	{
+		buffer[0] = '-';
+
+		// The magnitude is computed as an unsigned value so that INT32_MIN does not overflow
+		return 1 + Format_Digits(&buffer[1], 0U - (uint32_t)value, 1);
+	}
+
+	return Format_Digits(buffer, value, 1);
+}
+
+uint8_t Format_Fixed_Point(char *buffer, int32_t value, uint8_t decimals)
+{
+	uint8_t length = 0;
+
+	if (decimals > FORMAT_MAX_DECIMALS)
+	{
+		decimals = FORMAT_MAX_DECIMALS;
+	}
+
+	uint32_t magnitude = (value < 0) ? (0U - (uint32_t)value) : (uint32_t)value;
+	uint32_t integer_part = magnitude >> 16;
+
+	// Scale the 16-bit fraction to the number of decimals and round it to the nearest value
+	uint32_t fraction = (uint32_t)((((uint64_t)(magnitude & 0xFFFF) * powers_of_ten[decimals]) + 0x8000) >> 16);
+
+	// Carry into the integer part when the fraction is rounded up to 1 (e.g. 0.999 with 2 decimals)
+	if (fraction >= powers_of_ten[decimals])
+	{
+		fraction -= powers_of_ten[decimals];
+		integer_part++;
+	}
+
+	// Do not write a minus sign when the value is rounded to zero
+	if ((value < 0) && ((integer_part != 0) || (fraction != 0)))
+	{
+		buffer[length++] = '-';
+	}
+
+	length += Format_Digits(&buffer[length], integer_part, 1);
+
+	if (decimals > 0)
+	{
+		buffer[length++] = '.';
+		length += Format_Digits(&buffer[length], fraction, decimals);
+	}
+
+	return length;
+}
+
+uint8_t Format_Hexadecimal(char *buffer, uint32_t value, uint8_t min_digits)
+{
+	uint8_t length = 0;
+
+	// Skip the leading zeros, but keep at least one digit and at least min_digits digits
+	for (int8_t shift = 28; shift >= 0; shift -= 4)
+	{
+		uint8_t digit = (value >> shift) & 0xF;
+
+		if ((length == 0) && (digit == 0) && (shift != 0) && (shift >= (min_digits * 4)))
+		{
+			continue;
+		}
+
+		buffer[length++] = (digit < 0xA) ? (digit + '0') : ((digit - 0xA) + 'A');
+	}
+
+	buffer[length] = '\0';
+
+	return length;
+}
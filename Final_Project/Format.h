@@ -0,0 +1,130 @@
+/**
+ * @file Format.h
+ *
+ * @brief Header file for the Format driver.
+ *
+ * This file contains the function definitions for the Format driver.
+ * It converts numbers to strings without using sprintf, so the printf and floating-point
+ * libraries are not linked. It is used by the EduBase_LCD, UART0, and Seven_Segment_Display drivers.
+ *
+ * The Cortex-M4 does not need a loop of divisions to convert a number to decimal:
+ * a division by 10 is replaced by a 32 x 32 = 64-bit multiplication by the reciprocal
+ * 0xCCCCCCCD / 2^35, which gives the exact quotient for every 32-bit value.
+ *
+ * Format_BCD converts a value to packed binary-coded decimal (BCD) digits with a fixed number of
+ * reciprocal multiplications, so display drivers can look up each digit without hardware divides
+ * or string conversions, and the conversion takes the same time for every value.
+ *
+ * Fixed-point values use the Q16.16 format: a signed 32-bit integer whose lower 16 bits hold
+ * the fraction, so 1.0 is represented by FORMAT_Q16_16_ONE (0x00010000).
+ *
+ * Each function writes a null-terminated string to the buffer and returns its length.
+ * A buffer of FORMAT_BUFFER_SIZE characters is large enough for any string of this driver.
+ *
+ * @author Aaron Nanas
+ */
+
+#include "TM4C123GH6PM.h"
+
+// Size of a buffer that can hold any string of this driver:
+// sign (1), integer part of a Q16.16 value (5), decimal point (1), fraction (FORMAT_MAX_DECIMALS),
+// and the null character (1)
+#define FORMAT_BUFFER_SIZE          17
+
+// Maximum number of decimals of a Q16.16 value
+#define FORMAT_MAX_DECIMALS         9
+
+// Value of 1.0 in the Q16.16 format
+#define FORMAT_Q16_16_ONE           0x00010000
+
+// Number of BCD digits of an unsigned 32-bit value
+#define FORMAT_BCD_DIGITS           10
+
+// Returns the BCD digit (0 - 9) at the specified position of a packed BCD value (position 0 = least significant digit)
+#define FORMAT_BCD_DIGIT(bcd, position)     ((uint8_t)(((bcd) >> (4 * (position))) & 0x0F))
+
+/**
+ * @brief Divides an unsigned 32-bit value by 10 with a reciprocal multiplication.
+ *
+ * @param value The value to be divided.
+ *
+ * @return The quotient of value / 10.
+ */
+uint32_t Format_Divide_By_10(uint32_t value);
+
+/**
+ * @brief Converts an unsigned 32-bit value to packed binary-coded decimal (BCD) digits.
+ *
+ * Each digit occupies 4 bits, starting with the least significant digit in Bits 3 to 0.
+ * For example, 1234 is converted to 0x1234. All ten digits are always extracted,
+ * so the execution time does not depend on the value.
+ *
+ * @param value The value to be converted.
+ *
+ * @return The packed BCD digits (40 bits).
+ */
+uint64_t Format_BCD(uint32_t value);
+
+/**
+ * @brief Returns the number of significant digits of a packed BCD value.
+ *
+ * @param bcd The packed BCD digits returned by Format_BCD.
+ *
+ * @return The number of digits without the leading zeros (1 - 10). Zero has one digit.
+ */
+uint8_t Format_BCD_Digit_Count(uint64_t bcd);
+
+/**
+ * @brief Converts an unsigned 32-bit value to a decimal string.
+ *
+ * @param buffer The buffer that receives the string (at least 11 characters).
+ *
+ * @param value The value to be converted.
+ *
+ * @return The number of characters written, excluding the null character.
+ */
+uint8_t Format_Unsigned_Decimal(char *buffer, uint32_t value);
+
+/**
+ * @brief Converts a signed 32-bit value to a decimal string.
+ *
+ * A minus sign is written before negative values.
+ *
+ * @param buffer The buffer that receives the string (at least 12 characters).
+ *
+ * @param value The value to be converted.
+ *
+ * @return The number of characters written, excluding the null character.
+ */
+uint8_t Format_Signed_Decimal(char *buffer, int32_t value);
+
+/**
+ * @brief Converts a Q16.16 fixed-point value to a decimal string.
+ *
+ * The fraction is rounded to the nearest value with the specified number of decimals.
+ * For example, 0x00018000 is converted to "1.50" with 2 decimals.
+ *
+ * @param buffer The buffer that receives the string (at least FORMAT_BUFFER_SIZE characters).
+ *
+ * @param value The Q16.16 value to be converted.
+ *
+ * @param decimals The number of digits after the decimal point (0 - 9). If it is 0,
+ *                 the decimal point is not written.
+ *
+ * @return The number of characters written, excluding the null character.
+ */
+uint8_t Format_Fixed_Point(char *buffer, int32_t value, uint8_t decimals);
+
+/**
+ * @brief Converts an unsigned 32-bit value to an uppercase hexadecimal string.
+ *
+ * @param buffer The buffer that receives the string (at least 9 characters).
+ *
+ * @param value The value to be converted.
+ *
+ * @param min_digits The minimum number of digits (0 - 8). Leading zeros are added
+ *                   when the value has fewer digits.
+ *
+ * @return The number of characters written, excluding the null character.
+ */
+uint8_t Format_Hexadecimal(char *buffer, uint32_t value, uint8_t min_digits);
@@ -8,6 +8,7 @@
  *  - User LED (RGB) Tiva C Series TM4C123G LaunchPad
  *	- EduBase Board LEDs (LED0 - LED3)
  *	- EduBase Board Push Buttons (SW2 - SW5)
+ *	- User Switch SW1 (PF4) Tiva C Series TM4C123G LaunchPad
  *
  * To verify the pinout of the user LED, refer to the Tiva C Series TM4C123G LaunchPad User's Guide
  * Link: https://www.ti.com/lit/pdf/spmu296
@@ -17,6 +18,64 @@
 
 #include "GPIO.h"
 
+// Constant definitions for the user LED (RGB) colors
+const uint8_t RGB_LED_OFF         = 0x00;
+const uint8_t RGB_LED_RED         = 0x02;
+const uint8_t RGB_LED_BLUE        = 0x04;
+const uint8_t RGB_LED_GREEN       = 0x08;
+
+// Constant definitions for the EduBase board LEDs
+const uint8_t EDUBASE_LED_ALL_OFF = 0x00;
+const uint8_t EDUBASE_LED_ALL_ON  = 0x0F;
+
+void RGB_LED_Init(void)
+{
+	// Enable Clock to Port F
+	SYSCTL->RCGCGPIO |= 0x20;
+	
+	// Set PF1, PF2, and PF3 as output GPIO pins
+	GPIOF->DIR |= 0x0E;
+	
+	// Configure PF1, PF2, and PF3 to function as GPIO pins
+	GPIOF->AFSEL &= ~0x0E;
+	
+	// Enable Digital Functionality for PF1, PF2, and PF3
+	GPIOF->DEN |= 0x0E;
+	
+	// Initialize the output of the RGB LED to zero
+	GPIO_CLEAR_PINS(GPIOF, 0x0E);
+}
+
+void RGB_LED_Output(uint8_t led_value)
+{
+	// Set the output of the RGB LED
+	GPIO_WRITE_PINS(GPIOF, 0x0E, led_value);
+}
+
+void EduBase_LEDs_Init(void)
+{
+	// Enable Clock to Port B
+	SYSCTL->RCGCGPIO |= 0x02;
+	
+	// Set PB0, PB1, PB2, and PB3 as output GPIO pins
+	GPIOB->DIR |= 0x0F;
+	
+	// Configure PB0, PB1, PB2, and PB3 to function as GPIO pins
+	GPIOB->AFSEL &= ~0x0F;
+	
+	// Enable Digital Functionality for PB0, PB1, PB2, and PB3
+	GPIOB->DEN |= 0x0F;
+	
+	// Initialize the output of the EduBase LEDs to zero
+	GPIO_CLEAR_PINS(GPIOB, 0x0F);
+}
+
+void EduBase_LEDs_Output(uint8_t led_value)
+{
+	// Set the output of the EduBase LEDs
+	GPIO_WRITE_PINS(GPIOB, 0x0F, led_value);
+}
+
 void EduBase_Button_Init(void)
 {
 	// Enable Clock to Port D
@@ -34,7 +93,32 @@ void EduBase_Button_Init(void)
 
 uint8_t Get_EduBase_Button_Status(void)
 {
-	uint8_t button_status = GPIOD->DATA & 0xF;
+	uint8_t button_status = GPIO_READ_PINS(GPIOD, 0x0F);
+	return button_status;
+}
+
+void LaunchPad_Button_Init(void)
+{
+	// Enable Clock to Port F
+	SYSCTL->RCGCGPIO |= 0x20;
+	
+	// Set PF4 as an input GPIO pin
+	GPIOF->DIR &= ~0x10;
+	
+	// Configure PF4 to function as a GPIO pin
+	GPIOF->AFSEL &= ~0x10;
+	
+	// Enable the internal pull-up resistor for PF4
+	GPIOF->PUR |= 0x10;
+	
+	// Enable Digital Functionality for PF4
+	GPIOF->DEN |= 0x10;
+}
+
+uint8_t Get_LaunchPad_Button_Status(void)
+{
+	// SW1 is active low
+	uint8_t button_status = (GPIO_READ_PINS(GPIOF, 0x10) == 0) ? 0x01 : 0x00;
 	return button_status;
 }
 
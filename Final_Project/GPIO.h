@@ -1,6 +1,7 @@
 
 #include "TM4C123GH6PM.h"
 #include "SysTick_Delay.h"
+#include "GPIO_Pins.h"
 
 // Constant definitions for the user LED (RGB) colors
 extern const uint8_t RGB_LED_OFF;
@@ -14,6 +15,55 @@ extern const uint8_t EDUBASE_LED_ALL_ON;
 
 
 
+/**
+ * @brief The RGB_LED_Init function initializes the RGB LED (PF1 - PF3).
+ *
+ * This function configures the PF1, PF2, and PF3 pins as output GPIO pins
+ * and initializes the output of the RGB LED to off.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void RGB_LED_Init(void);
+
+/**
+ * @brief The RGB_LED_Output function sets the output of the RGB LED.
+ *
+ * The value is written to the address-masked alias of the DATA register for PF1 - PF3
+ * (see GPIO_Pins.h), so the state of the other Port F pins is preserved.
+ *
+ * @param led_value An 8-bit unsigned integer that determines the color of the RGB LED
+ *                  (RGB_LED_OFF, RGB_LED_RED, RGB_LED_BLUE or RGB_LED_GREEN).
+ *
+ * @return None
+ */
+void RGB_LED_Output(uint8_t led_value);
+
+/**
+ * @brief The EduBase_LEDs_Init function initializes the EduBase Board LEDs (PB0 - PB3).
+ *
+ * This function configures the PB0, PB1, PB2, and PB3 pins as output GPIO pins
+ * and initializes the output of the LEDs to off.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void EduBase_LEDs_Init(void);
+
+/**
+ * @brief The EduBase_LEDs_Output function sets the output of the EduBase Board LEDs.
+ *
+ * The value is written to the address-masked alias of the DATA register for PB0 - PB3
+ * (see GPIO_Pins.h), so the state of the other Port B pins is preserved.
+ *
+ * @param led_value An 8-bit unsigned integer that determines which LEDs (LED0 - LED3) are turned on.
+ *
+ * @return None
+ */
+void EduBase_LEDs_Output(uint8_t led_value);
+
 void EduBase_Button_Init(void);
 
 /**
@@ -36,6 +86,27 @@ void EduBase_Button_Init(void);
  */
 uint8_t Get_EduBase_Button_Status(void);
 
+/**
+ * @brief The LaunchPad_Button_Init function initializes the user switch SW1 (PF4) of the Tiva LaunchPad.
+ *
+ * This function configures the PF4 pin as an input GPIO pin and enables its internal pull-up resistor,
+ * since SW1 connects PF4 to ground when it is pressed.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void LaunchPad_Button_Init(void);
+
+/**
+ * @brief The Get_LaunchPad_Button_Status function reads the status of the user switch SW1 (PF4) of the Tiva LaunchPad.
+ *
+ * @param None
+ *
+ * @return 0x01 if SW1 is pressed, or 0x00 otherwise.
+ */
+uint8_t Get_LaunchPad_Button_Status(void);
+
 /**
  * @brief The LED_Pattern_1 function sets the output of the RGB LED and the EduBase Board LEDs.
  *
@@ -0,0 +1,45 @@
+/**
+ * @file GPIO_Pins.h
+ *
+ * @brief Header file for the GPIO pin access macros.
+ *
+ * This file contains macros that read and write a subset of the pins of a GPIO port with
+ * a single load or store, using the address-masked aliases of the GPIODATA register.
+ *
+ * The GPIODATA register of each port is mapped at 256 addresses. Bits 9 to 2 of the address
+ * are used as a mask: a write only modifies the pins whose mask bit is set, and a read returns
+ * zero for the pins whose mask bit is cleared (see the Data Register Operation section of the
+ * TM4C123GH6PM Microcontroller Datasheet).
+ * Compared to a read-modify-write of GPIOx->DATA, a masked write does not need to read the register,
+ * and it cannot overwrite the pins that are modified by an interrupt service routine between the
+ * read and the write.
+ *
+ * Example: GPIO_WRITE_PINS(GPIOA, 0x3C, value) drives PA5 - PA2 with Bits 5 to 2 of value
+ * and leaves the other pins of Port A unchanged.
+ *
+ * @note Link: https://www.ti.com/lit/gpn/TM4C123GH6PM
+ *
+ * @author Aaron Nanas
+ */
+
+#ifndef GPIO_PINS_H
+#define GPIO_PINS_H
+
+#include "TM4C123GH6PM.h"
+
+// Address-masked alias of the GPIODATA register of a port (e.g. GPIOA) for the pins selected by mask (0x00 - 0xFF)
+#define GPIO_MASKED_DATA(port, mask)        (*((volatile uint32_t *)((volatile uint8_t *)(port) + ((mask) << 2))))
+
+// Drives the pins selected by mask with the corresponding bits of value
+#define GPIO_WRITE_PINS(port, mask, value)  (GPIO_MASKED_DATA(port, mask) = (value))
+
+// Drives the pins selected by mask high
+#define GPIO_SET_PINS(port, mask)           (GPIO_MASKED_DATA(port, mask) = 0xFF)
+
+// Drives the pins selected by mask low
+#define GPIO_CLEAR_PINS(port, mask)         (GPIO_MASKED_DATA(port, mask) = 0x00)
+
+// Reads the pins selected by mask (the other bits are read as zero)
+#define GPIO_READ_PINS(port, mask)          (GPIO_MASKED_DATA(port, mask))
+
+#endif
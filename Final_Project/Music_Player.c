@@ -0,0 +1,300 @@
+/**
+ * @file Music_Player.c
+ *
+ * @brief Source code for the Music_Player driver.
+ *
+ * This file contains the function definitions for the Music_Player driver.
+ * It plays the songs stored in the packed song format (see Songs.h) in the background.
+ *
+ * The player state is shared between the Timer 1A interrupt and the main loop,
+ * so it is only modified while interrupts are disabled.
+ *
+ * @author Aaron Nanas
+ */
+
+#include "Music_Player.h"
+
+// States of the music player
+#define MUSIC_PLAYER_STOPPED    0
+#define MUSIC_PLAYER_PLAYING    1
+#define MUSIC_PLAYER_PAUSED     2
+
+static volatile uint8_t player_state = MUSIC_PLAYER_STOPPED;
+
+// Next event of the current song and length of a tick in milliseconds
+static const uint8_t *current_event = 0;
+static uint32_t tick_ms = SONG_DEFAULT_TICK_MS;
+
+// MIDI note number of the note that is playing (0 during a rest)
+static uint8_t current_note = 0;
+
+// Timer that ends the current event, and the timer wheel tick at which it expires
+static uint32_t event_timer = TIMER_WHEEL_INVALID_HANDLE;
+static uint32_t event_end_tick = 0;
+
+// Remaining time of the current event while the player is paused
+static uint32_t paused_remaining_ms = 0;
+
+// Queue of the songs to be played after the current song
+static const uint8_t *song_queue[MUSIC_PLAYER_QUEUE_SIZE];
+static uint8_t queue_head = 0;
+static uint8_t queue_count = 0;
+
+// User-defined function executed when the last song has finished
+static void (*music_finished_task)(void) = 0;
+
+static void Music_Player_Next_Event(void);
+
+static void Music_Player_Abort(void)
+{
+	// Silence the note and discard the songs, since the next event cannot be scheduled
+	DDS_Mixer_Silence_Voice(DDS_MIXER_MUSIC_VOICE);
+	player_state = MUSIC_PLAYER_STOPPED;
+	current_event = 0;
+	current_note = 0;
+	queue_head = 0;
+	queue_count = 0;
+
+	// Report that the player has stopped
+	if (music_finished_task != 0)
+	{
+		(*music_finished_task)();
+	}
+}
+
+static void Music_Player_Start_Event(void)
+{
+	event_timer = TIMER_WHEEL_INVALID_HANDLE;
+
+	while (1)
+	{
+		uint8_t opcode = current_event[0];
+		uint8_t operand = current_event[1];
+
+		if (opcode == SONG_OPCODE_END)
+		{
+			DDS_Mixer_Silence_Voice(DDS_MIXER_MUSIC_VOICE);
+			current_note = 0;
+
+			// Continue with the next song in the queue
+			if (queue_count > 0)
+			{
+				current_event = song_queue[queue_head];
+				queue_head = (queue_head + 1) % MUSIC_PLAYER_QUEUE_SIZE;
+				queue_count--;
+				tick_ms = SONG_DEFAULT_TICK_MS;
+				continue;
+			}
+
+			player_state = MUSIC_PLAYER_STOPPED;
+			current_event = 0;
+
+			if (music_finished_task != 0)
+			{
+				(*music_finished_task)();
+			}
+			return;
+		}
+
+		current_event += 2;
+
+		if (opcode == SONG_OPCODE_TEMPO)
+		{
+			tick_ms = operand;
+			continue;
+		}
+
+		uint32_t duration_ms = operand * tick_ms;
+
+		// Skip the events that have no duration
+		if (duration_ms == 0)
+		{
+			continue;
+		}
+
+		if (opcode == SONG_OPCODE_REST)
+		{
+			current_note = 0;
+			DDS_Mixer_Silence_Voice(DDS_MIXER_MUSIC_VOICE);
+		}
+		else
+		{
+			current_note = opcode;
+			DDS_Mixer_Set_Voice_Note(DDS_MIXER_MUSIC_VOICE, current_note, DDS_MIXER_MAX_VOLUME);
+		}
+
+		// Start the next event once this one is over
+		event_end_tick = Timer_Wheel_Get_Ticks() + duration_ms;
+		event_timer = Timer_Wheel_Arm(duration_ms, 0, &Music_Player_Next_Event);
+
+		// Stop the song instead of holding the note forever when every timer is in use
+		if (event_timer == TIMER_WHEEL_INVALID_HANDLE)
+		{
+			Music_Player_Abort();
+		}
+		return;
+	}
+}
+
+static void Music_Player_Next_Event(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	if (player_state == MUSIC_PLAYER_PLAYING)
+	{
+		Music_Player_Start_Event();
+	}
+
+	__set_PRIMASK(primask);
+}
+
+static void Music_Player_Cancel_Event(void)
+{
+	Timer_Wheel_Cancel(event_timer);
+	event_timer = TIMER_WHEEL_INVALID_HANDLE;
+	DDS_Mixer_Silence_Voice(DDS_MIXER_MUSIC_VOICE);
+}
+
+void Music_Player_Init(void(*finished_task)(void))
+{
+	music_finished_task = finished_task;
+	player_state = MUSIC_PLAYER_STOPPED;
+	current_event = 0;
+	current_note = 0;
+	event_timer = TIMER_WHEEL_INVALID_HANDLE;
+	queue_head = 0;
+	queue_count = 0;
+}
+
+void Music_Player_Play(const uint8_t song[])
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	if (player_state != MUSIC_PLAYER_STOPPED)
+	{
+		Music_Player_Cancel_Event();
+	}
+
+	current_event = song;
+	tick_ms = SONG_DEFAULT_TICK_MS;
+	player_state = MUSIC_PLAYER_PLAYING;
+	Music_Player_Start_Event();
+
+	__set_PRIMASK(primask);
+}
+
+uint8_t Music_Player_Queue(const uint8_t song[])
+{
+	uint8_t queued = 1;
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	if (player_state == MUSIC_PLAYER_STOPPED)
+	{
+		current_event = song;
+		tick_ms = SONG_DEFAULT_TICK_MS;
+		player_state = MUSIC_PLAYER_PLAYING;
+		Music_Player_Start_Event();
+	}
+	else if (queue_count < MUSIC_PLAYER_QUEUE_SIZE)
+	{
+		song_queue[(queue_head + queue_count) % MUSIC_PLAYER_QUEUE_SIZE] = song;
+		queue_count++;
+	}
+	else
+	{
+		queued = 0;
+	}
+
+	__set_PRIMASK(primask);
+
+	return queued;
+}
+
+void Music_Player_Pause(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	if (player_state == MUSIC_PLAYER_PLAYING)
+	{
+		// Save the remaining time of the current event
+		paused_remaining_ms = event_end_tick - Timer_Wheel_Get_Ticks();
+
+		if ((paused_remaining_ms == 0) || (paused_remaining_ms > 0x7FFFFFFF))
+		{
+			paused_remaining_ms = 1;
+		}
+
+		Music_Player_Cancel_Event();
+		player_state = MUSIC_PLAYER_PAUSED;
+	}
+
+	__set_PRIMASK(primask);
+}
+
+void Music_Player_Resume(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	if (player_state == MUSIC_PLAYER_PAUSED)
+	{
+		// Restart the note that was interrupted, if any
+		if (current_note != 0)
+		{
+			DDS_Mixer_Set_Voice_Note(DDS_MIXER_MUSIC_VOICE, current_note, DDS_MIXER_MAX_VOLUME);
+		}
+
+		player_state = MUSIC_PLAYER_PLAYING;
+		event_end_tick = Timer_Wheel_Get_Ticks() + paused_remaining_ms;
+		event_timer = Timer_Wheel_Arm(paused_remaining_ms, 0, &Music_Player_Next_Event);
+
+		// Stop the song instead of holding the note forever when every timer is in use
+		if (event_timer == TIMER_WHEEL_INVALID_HANDLE)
+		{
+			Music_Player_Abort();
+		}
+	}
+
+	__set_PRIMASK(primask);
+}
+
+void Music_Player_Stop(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	if (player_state != MUSIC_PLAYER_STOPPED)
+	{
+		Music_Player_Cancel_Event();
+	}
+
+	player_state = MUSIC_PLAYER_STOPPED;
+	current_event = 0;
+	current_note = 0;
+	queue_head = 0;
+	queue_count = 0;
+
+	__set_PRIMASK(primask);
+}
+
+uint8_t Music_Player_Is_Playing(void)
+{
+	return (player_state == MUSIC_PLAYER_PLAYING);
+}
+
+uint8_t Music_Player_Get_Pending_Songs(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	uint8_t pending_songs = queue_count + (player_state != MUSIC_PLAYER_STOPPED);
+
+	__set_PRIMASK(primask);
+
+	return pending_songs;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file Music_Player.h
+ *
+ * @brief Header file for the Music_Player driver.
+ *
+ * This file contains the function definitions for the Music_Player driver.
+ * It plays the songs stored in the packed song format (see Songs.h) in the background.
+ *
+ * Each note or rest is played on the music voice of the DDS mixer (DDS_MIXER_MUSIC_VOICE), so sound effects
+ * can be mixed with the song on the other voices. A one-shot timer wheel task is armed
+ * for the duration of the event. When the timer expires, the next event of the song is started
+ * from the Timer 1A interrupt, so the functions of this driver return immediately and the
+ * main loop keeps running while a song is playing.
+ *
+ * @note The Buzzer_Init, Timer_Wheel_Init and DDS_Mixer_Init functions must be called before Music_Player_Init,
+ * and the songs are only heard once DDS_Mixer_Start has been called.
+ *
+ * @author Aaron Nanas
+ */
+
+#include "TM4C123GH6PM.h"
+#include "Timer_Wheel.h"
+#include "Tone.h"
+#include "DDS_Mixer.h"
+#include "Songs.h"
+
+// Maximum number of songs that can wait in the queue
+#define MUSIC_PLAYER_QUEUE_SIZE 4
+
+/**
+ * @brief Initializes the music player.
+ *
+ * @param finished_task A pointer to a user-defined function that is executed when the last song
+ *                      has finished playing, or 0 if no notification is needed. It is also executed
+ *                      when the player stops because no timer wheel timer could be armed for the next
+ *                      event. The function can be executed from the Timer 1A interrupt, so it must be short.
+ *
+ * @return None
+ */
+void Music_Player_Init(void(*finished_task)(void));
+
+/**
+ * @brief Starts playing a song in the background.
+ *
+ * The song that is currently playing, if any, is stopped. The queued songs are kept
+ * and are played after this song.
+ *
+ * @param song A pointer to the first event of the song.
+ *
+ * @return None
+ */
+void Music_Player_Play(const uint8_t song[]);
+
+/**
+ * @brief Adds a song to the queue.
+ *
+ * If no song is playing or paused, the song starts playing immediately.
+ * Otherwise, it is played after the current song and the songs already in the queue.
+ *
+ * @param song A pointer to the first event of the song.
+ *
+ * @return 1 if the song has been started or queued, or 0 if the queue is full.
+ */
+uint8_t Music_Player_Queue(const uint8_t song[]);
+
+/**
+ * @brief Pauses the song that is currently playing.
+ *
+ * The buzzer is silenced and the remaining time of the current note is saved.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Music_Player_Pause(void);
+
+/**
+ * @brief Resumes a paused song from the note where it was paused.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Music_Player_Resume(void);
+
+/**
+ * @brief Stops the current song and empties the queue.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Music_Player_Stop(void);
+
+/**
+ * @brief Indicates whether a song is playing.
+ *
+ * @param None
+ *
+ * @return 1 if a song is playing, or 0 if the player is stopped or paused.
+ */
+uint8_t Music_Player_Is_Playing(void);
+
+/**
+ * @brief Returns the number of songs that have not finished playing.
+ *
+ * @param None
+ *
+ * @return The number of songs that are playing, paused or waiting in the queue.
+ */
+uint8_t Music_Player_Get_Pending_Songs(void);
@@ -87,7 +87,7 @@ uint8_t PMOD_BTN_Read(void)
 	// Declare a local variable to store the status of the PMOD BTN
 	// Then, read the DATA register for Port A
 	// A "0x3C" bit mask is used to capture only the pins used the PMOD BTN
-	uint8_t pmod_btn_state = GPIOA->DATA & 0x3C;
+	uint8_t pmod_btn_state = GPIO_READ_PINS(GPIOA, 0x3C);
 	
 	// Return the status of the PMOD BTN module
 	return pmod_btn_state;
@@ -17,6 +17,7 @@
  */
 
 #include "TM4C123GH6PM.h"
+#include "GPIO_Pins.h"
 
 // Declare pointer to the user-defined task
 extern void (*PMOD_BTN_Task)(uint8_t pmod_btn_state);
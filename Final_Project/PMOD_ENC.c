@@ -43,7 +43,7 @@ void PMOD_ENC_Init(void)
 
 uint8_t PMOD_ENC_Get_State(void)
 {
-    uint8_t state = GPIOD->DATA & PMOD_ENC_ALL_PINS_MASK;
+    uint8_t state = GPIO_READ_PINS(GPIOD, PMOD_ENC_ALL_PINS_MASK);
     return state;
 }
 
@@ -21,6 +21,7 @@
  */
 
 #include "TM4C123GH6PM.h"
+#include "GPIO_Pins.h"
 
 #define PMOD_ENC_PIN_A_MASK     0x01
 #define PMOD_ENC_PIN_B_MASK     0x02
@@ -0,0 +1,157 @@
+/**
+ * @file Scheduler.c
+ *
+ * @brief Source code for the Scheduler driver.
+ *
+ * This file contains the function definitions for the Scheduler driver.
+ * It provides a priority-based, run-to-completion cooperative scheduler for up to 32 tasks.
+ *
+ * The ready tasks are stored as a bit mask where the task with priority 0 uses
+ * the most significant bit, so the highest priority ready task is found with
+ * a single Count Leading Zeros (CLZ) instruction.
+ *
+ * @author Aaron Nanas
+ */
+
+#include "Scheduler.h"
+
+// Table of the user-defined tasks indexed by priority
+static void (*scheduler_tasks[SCHEDULER_MAX_TASKS])(uint32_t events);
+
+// Pending event flags of each task
+static volatile uint32_t pending_events[SCHEDULER_MAX_TASKS];
+
+// Remaining time of the timeout of each task in milliseconds
+static volatile uint32_t timeout_remaining[SCHEDULER_MAX_TASKS];
+
+// Bit mask of the tasks that are ready to run (Bit 31 = priority 0)
+static volatile uint32_t ready_mask = 0;
+
+// Bit mask of the tasks that have a pending timeout (Bit 31 = priority 0)
+static volatile uint32_t timeout_mask = 0;
+
+static void Scheduler_Timeout_Tick(void)
+{
+	uint32_t mask = timeout_mask;
+
+	// Count down the timeout of each task that has one pending
+	while (mask != 0)
+	{
+		uint8_t priority = __CLZ(mask);
+		uint32_t task_bit = 0x80000000 >> priority;
+		mask &= ~task_bit;
+
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+
+		if ((timeout_mask & task_bit) && (--timeout_remaining[priority] == 0))
+		{
+			timeout_mask &= ~task_bit;
+			pending_events[priority] |= SCHEDULER_EVENT_TIMEOUT;
+			ready_mask |= task_bit;
+		}
+
+		__set_PRIMASK(primask);
+	}
+}
+
+void Scheduler_Init(void)
+{
+	for (int i = 0; i < SCHEDULER_MAX_TASKS; i++)
+	{
+		scheduler_tasks[i] = 0;
+		pending_events[i] = 0;
+		timeout_remaining[i] = 0;
+	}
+
+	ready_mask = 0;
+	timeout_mask = 0;
+
+	// Count down the task timeouts every 1 ms
+	Timer_Wheel_Arm(1, 1, &Scheduler_Timeout_Tick);
+}
+
+void Scheduler_Add_Task(uint8_t priority, void(*task)(uint32_t events))
+{
+	if (priority < SCHEDULER_MAX_TASKS)
+	{
+		scheduler_tasks[priority] = task;
+	}
+}
+
+void Scheduler_Post(uint8_t priority, uint32_t events)
+{
+	if (priority >= SCHEDULER_MAX_TASKS)
+	{
+		return;
+	}
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	pending_events[priority] |= events;
+	ready_mask |= (0x80000000 >> priority);
+
+	__set_PRIMASK(primask);
+}
+
+void Scheduler_Set_Timeout(uint8_t priority, uint32_t timeout_ms)
+{
+	if (priority >= SCHEDULER_MAX_TASKS)
+	{
+		return;
+	}
+
+	uint32_t task_bit = 0x80000000 >> priority;
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	if (timeout_ms == 0)
+	{
+		timeout_mask &= ~task_bit;
+	}
+	else
+	{
+		timeout_remaining[priority] = timeout_ms;
+		timeout_mask |= task_bit;
+	}
+
+	// Discard a timeout event that has expired but has not been handled yet
+	pending_events[priority] &= ~SCHEDULER_EVENT_TIMEOUT;
+
+	__set_PRIMASK(primask);
+}
+
+void Scheduler_Run(void)
+{
+	while (1)
+	{
+		// Interrupts are disabled while the ready mask is checked so that an event posted
+		// by an interrupt cannot be missed between the check and the WFI instruction
+		__disable_irq();
+
+		if (ready_mask == 0)
+		{
+			// Sleep until an interrupt is pending. The processor wakes up even though
+			// interrupts are masked, and the interrupt is taken once they are re-enabled.
+			__WFI();
+			__enable_irq();
+			continue;
+		}
+
+		// Select the highest priority ready task and take its pending events
+		uint8_t priority = __CLZ(ready_mask);
+		uint32_t events = pending_events[priority];
+		pending_events[priority] = 0;
+		ready_mask &= ~(0x80000000 >> priority);
+
+		__enable_irq();
+
+		// Execute the task until it returns
+		if (scheduler_tasks[priority] != 0)
+		{
+			(*scheduler_tasks[priority])(events);
+		}
+	}
+}
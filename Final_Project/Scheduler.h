@@ -0,0 +1,94 @@
+/**
+ * @file Scheduler.h
+ *
+ * @brief Header file for the Scheduler driver.
+ *
+ * This file contains the function definitions for the Scheduler driver.
+ * It provides a priority-based, run-to-completion cooperative scheduler for up to 32 tasks.
+ *
+ * Each task is identified by its priority level (0 is the highest priority and 31 is the lowest)
+ * and has a set of pending event flags. Interrupt service routines and other tasks post events
+ * to a task with Scheduler_Post, which marks the task as ready. Scheduler_Run repeatedly
+ * executes the highest priority ready task and passes it the events that were posted since its
+ * last execution. A task must return quickly instead of waiting in a busy-wait loop. To wait
+ * for time to pass, a task sets a timeout with Scheduler_Set_Timeout and returns, and it is
+ * executed again with the SCHEDULER_EVENT_TIMEOUT flag once the timeout expires.
+ *
+ * When no task is ready, the processor is put to sleep with the WFI instruction
+ * until the next interrupt occurs.
+ *
+ * @note The timeouts are driven by the Timer_Wheel driver, so Timer_Wheel_Init
+ * must be called before Scheduler_Init.
+ *
+ * @author Aaron Nanas
+ */
+
+#include "TM4C123GH6PM.h"
+#include "Timer_Wheel.h"
+
+// Maximum number of tasks (one task per priority level)
+#define SCHEDULER_MAX_TASKS         32
+
+// Event flag posted to a task when its timeout expires
+#define SCHEDULER_EVENT_TIMEOUT     0x80000000
+
+/**
+ * @brief Initializes the scheduler.
+ *
+ * This function clears the task table, the pending events and the timeouts, and then arms a periodic
+ * 1 ms timer wheel task that counts down the timeouts of the tasks.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Scheduler_Init(void);
+
+/**
+ * @brief Registers a task with the scheduler.
+ *
+ * @param priority The priority level of the task (0 - 31). A lower number indicates a higher priority.
+ *
+ * @param task A pointer to the user-defined function to be executed. The function receives the
+ *             event flags that have been posted to the task since its last execution.
+ *
+ * @return None
+ */
+void Scheduler_Add_Task(uint8_t priority, void(*task)(uint32_t events));
+
+/**
+ * @brief Posts events to a task and marks the task as ready to run.
+ *
+ * This function can be called from the main loop, from any task and from any interrupt service routine.
+ *
+ * @param priority The priority level of the task that receives the events.
+ *
+ * @param events The event flags to be posted. The flags are combined with any pending events of the task.
+ *
+ * @return None
+ */
+void Scheduler_Post(uint8_t priority, uint32_t events);
+
+/**
+ * @brief Sets a timeout for a task.
+ *
+ * After timeout_ms milliseconds, the SCHEDULER_EVENT_TIMEOUT event is posted to the task.
+ * Each task has a single timeout. Setting a new timeout replaces the previous one, and
+ * a timeout of 0 cancels it.
+ *
+ * @param priority The priority level of the task.
+ *
+ * @param timeout_ms The timeout in milliseconds, or 0 to cancel the pending timeout.
+ *
+ * @return None
+ */
+void Scheduler_Set_Timeout(uint8_t priority, uint32_t timeout_ms);
+
+/**
+ * @brief Executes the ready tasks in order of priority. This function does not return.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Scheduler_Run(void);
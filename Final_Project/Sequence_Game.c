@@ -21,74 +21,289 @@
 // Global variable used to set the delay rate for flashing LEDs in milliseconds
 const uint32_t LED_DELAY_RATE = 500;
 
-void Generate_Sequence(uint8_t led_sequence[], uint8_t sequence_length)
-{	
+// Delay after a button press before the next input is accepted in milliseconds
+#define INPUT_DEBOUNCE_DELAY    200
+
+// Number of times the RGB LED blinks to show the result of a round
+#define RESULT_BLINK_COUNT      2
+
+// States of the Sequence Game task
+enum Sequence_Game_States
+{
+	GAME_IDLE,
+	GAME_SHOW_LED,
+	GAME_SHOW_GAP,
+	GAME_READ_INPUT,
+	GAME_INPUT_FEEDBACK,
+	GAME_RESULT_ON,
+	GAME_RESULT_OFF
+};
+
+// Priority level of the Sequence Game task
+static uint8_t game_priority = 0;
+
+// Current state of the Sequence Game task
+static uint8_t game_state = GAME_IDLE;
+
+// Generated LED sequence and the player's input sequence
+static uint8_t led_sequence[SEQUENCE_GAME_MAX_LENGTH];
+static uint8_t input_sequence[SEQUENCE_GAME_MAX_LENGTH];
+
+// Length of the sequence and the index of the current step in the sequence
+static uint8_t game_sequence_length = 0;
+static uint8_t game_index = 0;
+
+// Color of the RGB LED used to show the result and the number of remaining blinks
+static uint8_t result_color = 0;
+static uint8_t result_blinks_remaining = 0;
+
+// Number of LED patterns generated in the current round, so that a resumed round shows the same sequence again
+static uint8_t generated_count = 0;
+
+// Indicates whether the game is paused while it is in the background
+static uint8_t game_paused = 0;
+
+static void Sequence_Game_Show_Next_LED(void)
+{
 	// Initialize an array of possible LED values
-	uint8_t possible_values[4] = {1, 2, 4, 8};
+	static const uint8_t possible_values[4] = {1, 2, 4, 8};
 	
-	for (int i = 0; i < sequence_length; i++)
+	// Generate a random LED value from the possible_values array
+	// and store it in led_sequence, unless the pattern was generated before the game was paused
+	if (game_index >= generated_count)
 	{
-		// Generate a random LED value from the possible_values array
-		// and store it in led_sequence
-		led_sequence[i] = possible_values[rand() % 4];
-		
-		// Turn on the corresponding LED pattern from led_sequence
-		// and provide a short delay in milliseconds
-		EduBase_LEDs_Output(led_sequence[i]);
-		SysTick_Delay1ms(LED_DELAY_RATE);
+		led_sequence[game_index] = possible_values[rand() % 4];
+		generated_count = game_index + 1;
+	}
+	
+	// Turn on the corresponding LED pattern from led_sequence
+	// and wait for LED_DELAY_RATE milliseconds
+	EduBase_LEDs_Output(led_sequence[game_index]);
+	game_state = GAME_SHOW_LED;
+	Scheduler_Set_Timeout(game_priority, LED_DELAY_RATE);
+}
+
+static void Sequence_Game_Show_Result(void)
+{
+	// Assume that the player entered the correct input sequence
+	result_color = RGB_LED_GREEN;
+	
+	// Compare each input value from input_sequence
+	// with the corresponding LED value
+	for (int i = 0; i < game_sequence_length; i++)
+	{
+		if (input_sequence[i] != led_sequence[i])
+		{
+			result_color = RGB_LED_RED;
+			break;
+		}
+	}
+	
+	// Blink the RGB LED in green to indicate a correct input sequence
+	// or in red to indicate an incorrect input sequence
+	result_blinks_remaining = RESULT_BLINK_COUNT;
+	RGB_LED_Output(result_color);
+	game_state = GAME_RESULT_ON;
+	Scheduler_Set_Timeout(game_priority, LED_DELAY_RATE);
+}
+
+void Sequence_Game_Init(uint8_t priority)
+{
+	game_priority = priority;
+	game_state = GAME_IDLE;
+	
+	RGB_LED_Init();
+	EduBase_LEDs_Init();
+	
+	Scheduler_Add_Task(priority, &Sequence_Game_Task);
+}
+
+void Sequence_Game_Start(uint8_t sequence_length)
+{
+	if (sequence_length == 0 || sequence_length > SEQUENCE_GAME_MAX_LENGTH)
+	{
+		return;
+	}
+	
+	game_sequence_length = sequence_length;
+	Scheduler_Post(game_priority, SEQUENCE_GAME_EVENT_START);
+}
+
+void Sequence_Game_Pause(void)
+{
+	game_paused = 1;
+	
+	// Cancel the pending step, and turn off the LEDs and the sound
+	Scheduler_Set_Timeout(game_priority, 0);
+	EduBase_LEDs_Output(EDUBASE_LED_ALL_OFF);
+	RGB_LED_Output(RGB_LED_OFF);
+	DDS_Mixer_Silence_Voice(DDS_MIXER_EFFECT_VOICE);
+}
+
+uint8_t Sequence_Game_Resume(void)
+{
+	game_paused = 0;
+	
+	switch (game_state)
+	{
+		// Show the sequence of the interrupted round again from its first pattern
+		case GAME_SHOW_LED:
+		case GAME_SHOW_GAP:
+		case GAME_READ_INPUT:
+		case GAME_INPUT_FEEDBACK:
+		{
+			game_index = 0;
+			Sequence_Game_Show_Next_LED();
+			return 1;
+		}
 		
-		// Turn off all LEDs on the EduBase board
-		// and provide a short delay in milliseconds
-		EduBase_LEDs_Output(EDUBASE_LED_ALL_OFF);
-		SysTick_Delay1ms(LED_DELAY_RATE);
+		// The game has not been started, or the round was over
+		default:
+		{
+			game_state = GAME_IDLE;
+			return 0;
+		}
 	}
 }
 
-void Read_Player_Input(uint8_t input_sequence[], uint8_t sequence_length)
-{		
-	for (int i = 0; i < sequence_length; i++)
+void Sequence_Game_Task(uint32_t events)
+{
+	uint8_t button_status = events & 0x0F;
+	
+	if (events & SEQUENCE_GAME_EVENT_START)
+	{
+		// Start generating a new sequence
+		game_paused = 0;
+		game_index = 0;
+		generated_count = 0;
+		Sequence_Game_Show_Next_LED();
+		return;
+	}
+	
+	// Ignore the buttons and the timeouts while the game is paused
+	if (game_paused)
 	{
-		// Wait until a button is pressed
-		while (Get_EduBase_Button_Status() == 0x0);
+		return;
+	}
+	
+	switch (game_state)
+	{
+		case GAME_SHOW_LED:
+		{
+			if (events & SCHEDULER_EVENT_TIMEOUT)
+			{
+				// Turn off all LEDs on the EduBase board
+				// and wait for LED_DELAY_RATE milliseconds
+				EduBase_LEDs_Output(EDUBASE_LED_ALL_OFF);
+				game_state = GAME_SHOW_GAP;
+				Scheduler_Set_Timeout(game_priority, LED_DELAY_RATE);
+			}
+			break;
+		}
 		
-		// Read the value of the button pressed and store it in the input_sequence array
-		input_sequence[i] = GPIOD->DATA & 0x0F;
+		case GAME_SHOW_GAP:
+		{
+			if (events & SCHEDULER_EVENT_TIMEOUT)
+			{
+				game_index++;
+				
+				// Show the next LED pattern or wait for the player's input
+				// after the whole sequence has been shown
+				if (game_index < game_sequence_length)
+				{
+					Sequence_Game_Show_Next_LED();
+				}
+				else
+				{
+					game_index = 0;
+					game_state = GAME_READ_INPUT;
+				}
+			}
+			break;
+		}
 		
-		// Display the LED pattern corresponding to the button pressed
-		EduBase_LEDs_Output(input_sequence[i]);
+		case GAME_READ_INPUT:
+		{
+			if (button_status != 0)
+			{
+				// Store the value of the button pressed in the input_sequence array
+				input_sequence[game_index] = button_status;
+				
+				// Display the LED pattern corresponding to the button pressed
+				EduBase_LEDs_Output(button_status);
+				
+				// Start a sound on the sound effect voice of the DDS mixer, which is stopped once the
+				// debounce delay has elapsed. It is mixed with the song of the music player, if any.
+				DDS_Mixer_Set_Voice_Note(DDS_MIXER_EFFECT_VOICE, NOTE_G4, DDS_MIXER_MAX_VOLUME);
+				
+				// Ignore button presses for a short delay
+				// to prevent any bouncing effects
+				game_state = GAME_INPUT_FEEDBACK;
+				Scheduler_Set_Timeout(game_priority, INPUT_DEBOUNCE_DELAY);
+			}
+			break;
+		}
 		
-		// Play a sound using the buzzer for a short duration
-		Play_Note(G4_NOTE, 75);
+		case GAME_INPUT_FEEDBACK:
+		{
+			if (events & SCHEDULER_EVENT_TIMEOUT)
+			{
+				// Turn off all LEDs and stop the sound
+				EduBase_LEDs_Output(EDUBASE_LED_ALL_OFF);
+				DDS_Mixer_Silence_Voice(DDS_MIXER_EFFECT_VOICE);
+				
+				game_index++;
+				
+				// Compare the sequences once all of the inputs have been read
+				if (game_index < game_sequence_length)
+				{
+					game_state = GAME_READ_INPUT;
+				}
+				else
+				{
+					Sequence_Game_Show_Result();
+				}
+			}
+			break;
+		}
 		
-		// Wait until the button is released
-		while (Get_EduBase_Button_Status() != 0x0);
+		case GAME_RESULT_ON:
+		{
+			if (events & SCHEDULER_EVENT_TIMEOUT)
+			{
+				RGB_LED_Output(RGB_LED_OFF);
+				game_state = GAME_RESULT_OFF;
+				Scheduler_Set_Timeout(game_priority, LED_DELAY_RATE);
+			}
+			break;
+		}
 		
-		// Turn off all LEDs
-		EduBase_LEDs_Output(EDUBASE_LED_ALL_OFF);
+		case GAME_RESULT_OFF:
+		{
+			if (events & SCHEDULER_EVENT_TIMEOUT)
+			{
+				result_blinks_remaining--;
+				
+				// Blink again or start a new round once the blinking is done
+				if (result_blinks_remaining > 0)
+				{
+					RGB_LED_Output(result_color);
+					game_state = GAME_RESULT_ON;
+					Scheduler_Set_Timeout(game_priority, LED_DELAY_RATE);
+				}
+				else
+				{
+					game_index = 0;
+					generated_count = 0;
+					Sequence_Game_Show_Next_LED();
+				}
+			}
+			break;
+		}
 		
-		// Provide a short delay after a button has been released
-		// to prevent any bouncing effects
-		SysTick_Delay1ms(200);
-	}
-}
-
-void Compare_Sequence(uint8_t led_sequence[], uint8_t input_sequence[], uint8_t sequence_length)
-{
-	// Compare each input value from input_sequence
-	// with the corresponding LED value
-	for (int i = 0; i < sequence_length; i++)
-	{
-		// Blink the RGB LED in red twice to indicate
-		// that the user entered the incorrect input sequence
-		// and exit out of the function
-		if (input_sequence[i] != led_sequence[i])
+		default:
 		{
-			Blink_RGB_LED(RGB_LED_RED, 2, LED_DELAY_RATE);
-			return;
+			break;
 		}
 	}
-	
-	// Blink the RGB LED in green twice to indicate
-	// that the user entered the correct input sequence
-	Blink_RGB_LED(RGB_LED_GREEN, 2, LED_DELAY_RATE);
 }
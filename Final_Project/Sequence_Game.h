@@ -21,63 +21,84 @@
 #include "SysTick_Delay.h"
 #include "GPIO.h"
 #include "Buzzer.h"
+#include "Scheduler.h"
 
 // Global variable used to set the delay rate for flashing LEDs in milliseconds
 extern const uint32_t LED_DELAY_RATE;
 
+// Maximum length of the LED sequence
+#define SEQUENCE_GAME_MAX_LENGTH    16
+
+// Event flag posted to the Sequence Game task by Sequence_Game_Start
+#define SEQUENCE_GAME_EVENT_START   0x00000100
+
 /**
- * @brief The Generate_Sequence function generates a pseudo-random sequence of LED patterns and outputs them to the LEDs.
+ * @brief The Sequence_Game_Init function registers the Sequence Game task with the scheduler.
  *
- * This function generates a sequence of LED patterns by randomly selecting values from the possible_values array
- * using the rand() function and storing them in the led_sequence array. For each value in the sequence, 
- * it outputs the corresponding LED pattern using the EduBase_LEDs_Output function, followed by a delay 
- * of LED_DELAY_RATE milliseconds. After each LED pattern is displayed, all LEDs are turned off 
- * for the same duration to create a blinking effect.
+ * This function stores the priority level used by the Sequence Game task, registers
+ * Sequence_Game_Task with the scheduler, and initializes the RGB LED and the EduBase board LEDs.
  *
- * "rand() % 4" generates a pseudo-random number uses the modulo operator
- * to calculate the remainder when the random number is divided by 4,
- * providing a result between 0 and 3 because any (integer % 4) can only have a 
- * remainder in this range
- *
- * @param led_sequence An array to store the generated LED sequence.
- * 
- * @param sequence_length The length of the LED sequence to generate.
+ * @param priority The priority level of the Sequence Game task.
  *
  * @return None
  */
-void Generate_Sequence(uint8_t led_sequence[], uint8_t sequence_length);
+void Sequence_Game_Init(uint8_t priority);
 
 /**
- * @brief The Read_Player_Input function reads the player's input from the buttons, displays corresponding LED patterns, and plays buzzer sounds.
+ * @brief The Sequence_Game_Start function starts a new round of the Sequence Game.
+ *
+ * @param sequence_length The length of the LED sequence to generate (1 - SEQUENCE_GAME_MAX_LENGTH).
  *
- * This function reads the player's input from EduBase board push buttons. It waits until any button is pressed, reads
- * the value of the pressed button, and stores it in the input_sequence array. For each button press, it displays the
- * corresponding LED pattern using the EduBase_LEDs_Output function and plays the corresponding note using the Play_Note function.
- * It then waits until the button is released before proceeding to the next input. After each input, it turns off all LEDs
- * and waits for a short duration.
+ * @return None
+ */
+void Sequence_Game_Start(uint8_t sequence_length);
+
+/**
+ * @brief The Sequence_Game_Pause function pauses the Sequence Game while it is in the background.
  *
- * @param input_sequence An array to store the player's input sequence.
+ * The pending step of the game is cancelled, the LEDs and the sound are turned off, and the
+ * button events are ignored until Sequence_Game_Resume or Sequence_Game_Start is called.
  *
- * @param sequence_length The length of the input sequence to read.
+ * @param None
  *
  * @return None
  */
-void Read_Player_Input(uint8_t input_sequence[], uint8_t sequence_length);
+void Sequence_Game_Pause(void);
 
 /**
- * @brief The Compare_Sequence function compares the player's input sequence with the generated LED sequence.
+ * @brief The Sequence_Game_Resume function resumes the round that was interrupted by Sequence_Game_Pause.
+ *
+ * The sequence of the interrupted round is shown again from its first pattern, and the player
+ * enters the whole sequence again.
+ *
+ * @param None
+ *
+ * @return 1 if a round was resumed, or 0 if no round was in progress (Sequence_Game_Start starts a new one).
+ */
+uint8_t Sequence_Game_Resume(void);
+
+/**
+ * @brief The Sequence_Game_Task function executes one step of the Sequence Game.
+ *
+ * The game is implemented as a state machine so that the task never waits in a busy-wait loop.
+ * Each round goes through the following phases:
  *
- * This function compares the player's input sequence with the generated LED sequence
- * to determine if the player correctly reproduced the sequence. If any input value differs from the corresponding
- * LED sequence value, the function indicates a wrong input by blinking the RGB LED in red twice. If the input matches
- * the LED sequence, the function indicates a correct input by blinking the RGB LED in green twice.
+ * - Generate: A pseudo-random sequence of LED patterns is generated by selecting values from
+ *   {1, 2, 4, 8} with "rand() % 4". Each pattern is shown on the EduBase board LEDs for
+ *   LED_DELAY_RATE milliseconds, followed by all LEDs turned off for the same duration.
+ *   The task sets a scheduler timeout and returns after each step.
  *
- * @param led_sequence The generated LED sequence to compare against.
+ * - Read Player Input: Each button press event shows the corresponding LED pattern and plays
+ *   a short note with the buzzer. The LEDs are turned off 200 ms later, and button presses
+ *   within those 200 ms are ignored to prevent any bouncing effects.
  *
- * @param input_sequence The player's input sequence to compare.
+ * - Compare: The player's input sequence is compared with the generated LED sequence.
+ *   The RGB LED blinks in green twice if the sequences match. Otherwise, it blinks in red twice.
+ *   A new round starts after the blinking ends.
  *
- * @param sequence_length The length of the sequences to compare.
+ * @param events The event flags posted to the task. Bits 3 to 0 indicate the EduBase board
+ *               push buttons that have been pressed (SW5 = 0x01, SW4 = 0x02, SW3 = 0x04, SW2 = 0x08).
  *
  * @return None
  */
-void Compare_Sequence(uint8_t led_sequence[], uint8_t input_sequence[], uint8_t sequence_length);
+void Sequence_Game_Task(uint32_t events);
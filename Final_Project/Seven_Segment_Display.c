@@ -5,8 +5,9 @@
  *
  * This file contains the function definitions for the Seven_Segment_Display driver.
  * It interfaces with the Seven-Segment Display module on the EduBase board.
+ * The digits are multiplexed in the background by the Timer 4A interrupt.
  *
- * @note Assumes that a 16 MHz clock is used.
+ * @note Assumes that a 50 MHz clock is used.
  *
  * @author Aaron Nanas
  */
@@ -34,6 +35,96 @@ const uint8_t number_pattern[16] =
 	0x8E  // F
 };
 
+// Length of the time slot of each digit in system clock cycles
+#define SEVEN_SEGMENT_SLOT_CYCLES (SEVEN_SEGMENT_REFRESH_PERIOD_US * SYSTICK_DELAY_CYCLES_PER_US)
+
+// Time during which a digit is lit in each slot for every brightness level, in system clock cycles
+// The values follow a gamma curve of 2.2 (500 + 49500 * (level / 31)^2.2), so that the brightness
+// appears to increase evenly. The shortest time (10 us) leaves room for the 5 us transfer of the
+// blank pattern, and the last level lights the digit for the whole slot
+static const uint16_t brightness_on_cycles[SEVEN_SEGMENT_BRIGHTNESS_LEVELS] =
+{
+	  500,   526,   619,   791,  1047,  1394,  1835,  2374,
+	 3014,  3758,  4608,  5566,  6635,  7816,  9112, 10523,
+	12052, 13701, 15470, 17360, 19375, 21513, 23778, 26169,
+	28689, 31337, 34116, 37027, 40069, 43245, 46555, 50000
+};
+
+// Segment patterns of the digits that are displayed, from the rightmost digit (Digit 0)
+static volatile uint8_t segment_buffer[SEVEN_SEGMENT_DISPLAY_DIGITS];
+
+// Digit that has been queued in the SSI2 transmit FIFO
+static uint8_t refresh_digit = 0;
+
+// Indicates whether the blank pattern, instead of a digit, has been queued in the SSI2 transmit FIFO
+static uint8_t blank_queued = 1;
+
+// Blanking time of the current slot in system clock cycles
+static uint32_t blank_cycles = SEVEN_SEGMENT_SLOT_CYCLES;
+
+// Current brightness level
+static volatile uint8_t brightness_level = SEVEN_SEGMENT_BRIGHTNESS_LEVELS - 1;
+
+// Light sensor reading filtered by Seven_Segment_Auto_Brightness, scaled by 2^SEVEN_SEGMENT_LIGHT_FILTER_SHIFT
+static uint32_t filtered_light = 0;
+static uint8_t filtered_light_valid = 0;
+
+static void Seven_Segment_Refresh_Init(void)
+{
+	for (uint8_t i = 0; i < SEVEN_SEGMENT_DISPLAY_DIGITS; i++)
+	{
+		segment_buffer[i] = SEVEN_SEGMENT_BLANK_PATTERN;
+	}
+	
+	refresh_digit = 0;
+	blank_queued = 1;
+	blank_cycles = SEVEN_SEGMENT_SLOT_CYCLES;
+	
+	// Set the R4 bit (Bit 4) in the RCGCTIMER register
+	// to enable the clock for Timer 4A
+	SYSCTL->RCGCTIMER |= 0x10;
+	
+	// Wait until Timer 4 is ready to be accessed
+	while ((SYSCTL->PRTIMER & 0x10) == 0);
+	
+	// Clear the TAEN bit (Bit 0) of the GPTMCTL register
+	// to disable Timer 4A
+	TIMER4->CTL &= ~0x01;
+	
+	// Set the bits of the GPTMCFG field (Bits 2 to 0) in the GPTMCFG register
+	// 0x0 = Select the 32-bit timer configuration
+	TIMER4->CFG = 0x00;
+	
+	// Set the bits of the TAMR field (Bits 1 to 0) to enable
+	// One-Shot Timer mode in the GPTMTAMR register
+	// The timer is started again by the interrupt with the length of the next phase
+	// (the lit part or the blank part of a slot)
+	TIMER4->TAMR = 0x01;
+	
+	// Load the time until the first interrupt by writing to the
+	// TAILR field (Bits 31 to 0) in the GPTMTAILR register
+	TIMER4->TAILR = SEVEN_SEGMENT_SLOT_CYCLES - 1;
+	
+	// Set the TATOCINT bit (Bit 0) to 1 in the GPTMICR register
+	// The TATOCINT bit will be automatically cleared when it is set to 1
+	TIMER4->ICR = 0x01;
+	
+	// Enable the Timer 4A interrupt by setting the TATOIM bit (Bit 0)
+	// in the GPTMIMR register
+	TIMER4->IMR |= 0x01;
+	
+	// Set the priority level to 3 for the Timer 4A interrupt so that it does not
+	// delay the timer wheel (Timer 1A), the sample interrupt (Timer 2A), or the LCD queue (Timer 3A)
+	// Timer 4A has an IRQ of 70
+	NVIC->IP[70] = (3 << 5);
+	
+	// Enable IRQ 70 for Timer 4A by setting Bit 6 in the ISER[2] register
+	NVIC->ISER[2] |= (1 << 6);
+	
+	// Set the TAEN bit (Bit 0) in the GPTMCTL register to enable Timer 4A
+	TIMER4->CTL |= 0x01;
+}
+
 void Seven_Segment_Display_Init(void)
 {
 	// Enable Clock to Port B (Bit 1)
@@ -73,7 +164,7 @@ void Seven_Segment_Display_Init(void)
 
 	// Initialize the output of the PC7 pin to high
 	// by setting Bit 7 of the DATA register for Port C
-	GPIOC->DATA |= 0x80;
+	GPIO_SET_PINS(GPIOC, 0x80);
 
 	// Disable SSI2 during configuration
 	SSI2->CR1 = 0;
@@ -81,9 +172,9 @@ void Seven_Segment_Display_Init(void)
 	// Use system clock as the clock source
 	SSI2->CC = 0;
 
-	// Assumes that a 16 MHz clock is used
+	// Assumes that a 50 MHz clock is used
 	// Set the prescale value to 16
-	// New clock frequency = (16 MHz / 16) = 1 MHz
+	// New clock frequency = (50 MHz / 16) = 3.125 MHz
 	SSI2->CPSR = 16;
 
 	// Select 8-bit data format (DSS = 0x07)
@@ -96,13 +187,16 @@ void Seven_Segment_Display_Init(void)
 	// Set the Synchronous Serial Enable bit (SSE)
 	// Enable SSI in master mode (MS = 0)
 	SSI2->CR1 |= 0x02;
+	
+	// Start multiplexing the digits in the background
+	Seven_Segment_Refresh_Init();
 }
 
 void SSI2_Write(uint8_t data)
 {
 	// Assert the slave select pin by clearing Bit 7
 	// of the DATA register for Port C
-	GPIOC->DATA &= ~0x80;
+	GPIO_CLEAR_PINS(GPIOC, 0x80);
 
 	// Write the data to the SSI Data Register (SSIDR)
 	SSI2->DR = data;
@@ -113,94 +207,121 @@ void SSI2_Write(uint8_t data)
 
 	// Deassert the slave select pin by setting Bit 7
 	// of the DATA register for Port C
-	GPIOC->DATA |= 0x80;
+	GPIO_SET_PINS(GPIOC, 0x80);
 }
 
 int Count_Digits(int value)
 {
-	// Initialize the digit counter
-	int num_digits = 0;
-
-	// Iterate until the value becomes zero
-	while (value != 0)
+	// Zero has no digits to display
+	if (value == 0)
 	{
-		// Divide the value by 10
-		value = value / 10;
-		
-		// Increment the digit counter
-		num_digits++;
+		return 0;
 	}
 	
-	// Return the number of digits
-	return num_digits;
+	// Count the significant BCD digits of the magnitude of the value
+	uint32_t magnitude = (value < 0) ? (0U - (uint32_t)value) : (uint32_t)value;
+	return Format_BCD_Digit_Count(Format_BCD(magnitude));
+}
+
+void Seven_Segment_Set_Value(uint32_t value)
+{
+	// Convert the value to packed BCD digits without hardware divides
+	uint64_t bcd = Format_BCD(value);
+	uint8_t num_digits = Format_BCD_Digit_Count(bcd);
+	
+	// Look up the pattern of each BCD digit from the least significant one,
+	// and blank the digits to the left of the most significant digit
+	for (uint8_t i = 0; i < SEVEN_SEGMENT_DISPLAY_DIGITS; i++)
+	{
+		segment_buffer[i] = (i < num_digits) ? number_pattern[FORMAT_BCD_DIGIT(bcd, i)] : SEVEN_SEGMENT_BLANK_PATTERN;
+	}
 }
 
 void Seven_Segment_Display(int count_value)
 {
-	// If the count value is zero, then display "0" on the seven-segment display
-	if (count_value == 0)
+	Seven_Segment_Set_Value(count_value);
+}
+
+void Seven_Segment_Display_Stopwatch(uint8_t stopwatch_value[])
+{
+	// Store the pattern of each digit of the stopwatch value
+	for (uint8_t i = 0; i < SEVEN_SEGMENT_DISPLAY_DIGITS; i++)
 	{
-		// Send the command to write "0" on the seven-segment display
-		SSI2_Write(number_pattern[0]);
-		
-		// Send the command to write "0" as the first digit on the seven-segment display
-		SSI2_Write(1);
-		
-		// Exit the function using the return statement
-		return;
+		segment_buffer[i] = number_pattern[stopwatch_value[i]];
 	}
+}
 
-	// Count the number of digits in count_value
-	int num_digits = Count_Digits(count_value);
+void Seven_Segment_Set_Brightness(uint8_t level)
+{
+	if (level >= SEVEN_SEGMENT_BRIGHTNESS_LEVELS)
+	{
+		level = SEVEN_SEGMENT_BRIGHTNESS_LEVELS - 1;
+	}
 	
-	// Initialize a local variable to store the extracted digit
-	int digit = 0;
+	brightness_level = level;
+}
 
-	// Iterate through each digit in count_value
-	for (uint8_t i = 1; i < (num_digits * 2); i = i * 2)
+void Seven_Segment_Auto_Brightness(uint16_t light_sample)
+{
+	// Start the filter from the first reading
+	if (!filtered_light_valid)
 	{
-		// Get the least significant digit
-		digit = count_value % 10;
-		
-		// Remove the least significant digit from count_value by dividing by 10
-		count_value = count_value / 10;
-		
-		// Send the command to write the extracted digit's pattern on the seven-segment display
-		SSI2_Write(number_pattern[digit]);
-		
-		// Send the command to write each digit in the correct place on the seven-segment display
-		SSI2_Write(i);
-		
-		// Add a short delay in order to show all digits on the seven-segment display
-		SysTick_Delay1ms(1);
+		filtered_light = (uint32_t)light_sample << SEVEN_SEGMENT_LIGHT_FILTER_SHIFT;
+		filtered_light_valid = 1;
 	}
+	
+	// Exponential moving average: each reading moves the filtered value by 1 / 2^SEVEN_SEGMENT_LIGHT_FILTER_SHIFT
+	// of the difference, so a sudden change of the ambient light fades the brightness over several readings
+	filtered_light = filtered_light - (filtered_light >> SEVEN_SEGMENT_LIGHT_FILTER_SHIFT) + light_sample;
+	
+	// Map the filtered 12-bit reading (0 - 4095) to a brightness level (0 - 31)
+	// A brighter environment selects a brighter display
+	uint32_t light = filtered_light >> SEVEN_SEGMENT_LIGHT_FILTER_SHIFT;
+	Seven_Segment_Set_Brightness((light * SEVEN_SEGMENT_BRIGHTNESS_LEVELS) >> 12);
 }
 
-void Seven_Segment_Display_Stopwatch(uint8_t stopwatch_value[])
+void TIMER4A_Handler(void)
 {
-	int stopwatch_value_idx = 0;
+	// Acknowledge the Timer 4A timeout by setting the
+	// TATOCINT bit (Bit 0) in the GPTMICR register
+	TIMER4->ICR = 0x01;
+	
+	// Latch the bytes that were shifted out during the previous interrupt by deasserting
+	// the slave select pin (PC7). Their transfer (16 bits at 3.125 MHz, about 5 us)
+	// has completed before this interrupt. Then, assert the slave select pin again
+	GPIO_SET_PINS(GPIOC, 0x80);
+	GPIO_CLEAR_PINS(GPIOC, 0x80);
 	
-	// Iterate through each segment of the display
-	for (uint8_t i = 1; i <= 8; i = i * 2)
+	uint32_t delay_cycles;
+	
+	if (!blank_queued && (brightness_on_cycles[brightness_level] < SEVEN_SEGMENT_SLOT_CYCLES))
 	{
-		if (stopwatch_value[stopwatch_value_idx] == 0)
-		{
-			// Send the command to write "0" on the seven-segment display if the value is zero
-			SSI2_Write(number_pattern[0]);
-		}
-		else
-		{
-			// Send the corresponding digit on the seven-segment display
-			SSI2_Write(number_pattern[stopwatch_value[stopwatch_value_idx]]);
-		}
-		
-		// Send the command to write each digit in the correct place on the seven-segment display
-		SSI2_Write(i);
+		// The digit has just been lit: queue the blank pattern, which is latched
+		// by the next interrupt once the digit has been lit for the time of the brightness level
+		uint32_t on_cycles = brightness_on_cycles[brightness_level];
+		blank_cycles = SEVEN_SEGMENT_SLOT_CYCLES - on_cycles;
+		delay_cycles = on_cycles;
 		
-		// Increment a counter to move to the next digit of the stopwatch value
-		stopwatch_value_idx++;
+		SSI2->DR = SEVEN_SEGMENT_BLANK_PATTERN;
+		SSI2->DR = 1 << refresh_digit;
+		blank_queued = 1;
+	}
+	else
+	{
+		// Either the rest of the slot is blank, or the digit is lit for the whole slot
+		delay_cycles = blank_queued ? blank_cycles : SEVEN_SEGMENT_SLOT_CYCLES;
 		
-		// Provide a 1 ms delay between each segment update
-		SysTick_Delay1ms(1);
+		// Queue the pattern of the next digit, followed by the place of the digit,
+		// in the SSI2 transmit FIFO (8 entries). The interrupt returns without waiting
+		// for the BSY bit, and the digit is latched by the next interrupt
+		refresh_digit = (refresh_digit + 1) & (SEVEN_SEGMENT_DISPLAY_DIGITS - 1);
+		SSI2->DR = segment_buffer[refresh_digit];
+		SSI2->DR = 1 << refresh_digit;
+		blank_queued = 0;
 	}
+	
+	// Load the length of the next phase into the TAILR field (Bits 31 to 0) of the GPTMTAILR register
+	// and set the TAEN bit (Bit 0) in the GPTMCTL register to start Timer 4A
+	TIMER4->TAILR = delay_cycles - 1;
+	TIMER4->CTL |= 0x01;
 }
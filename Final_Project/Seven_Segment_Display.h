@@ -6,13 +6,49 @@
  * This file contains the function definitions for the Seven_Segment_Display driver.
  * It interfaces with the Seven-Segment Display module on the EduBase board.
  *
- * @note Assumes that a 16 MHz clock is used.
+ * The patterns of the four digits are stored in a buffer in RAM. The Timer 4A interrupt lights
+ * one digit in each slot of SEVEN_SEGMENT_REFRESH_PERIOD_US microseconds over SSI2, so the
+ * display is refreshed at 250 Hz and stays lit no matter what the main program is doing.
+ *
+ * The brightness is set by blanking each digit for part of its slot. The lit time of each of the
+ * SEVEN_SEGMENT_BRIGHTNESS_LEVELS levels is timed by Timer 4A, so it does not depend on the
+ * workload of the main program. Seven_Segment_Auto_Brightness adjusts the level from a filtered
+ * reading of the light sensor.
+ * The functions that change the displayed value only update the buffer and return immediately.
+ *
+ * Each interrupt queues the segment pattern and the digit select byte of one digit in the SSI2
+ * transmit FIFO and returns without waiting for the transfer. The next interrupt latches the digit
+ * into the shift registers by deasserting the slave select pin (PC7), so the CPU never waits for
+ * the BSY bit. At full brightness, a full display update costs about 180 CPU cycles (4 interrupts of about 45 cycles),
+ * compared to about 1360 cycles when each byte was written with SSI2_Write (estimated from the
+ * instruction counts and the 2.56 us transfer time of a byte).
+ *
+ * @note Assumes that a 50 MHz clock is used.
  *
  * @author Aaron Nanas
  */
 
 #include "TM4C123GH6PM.h"
 #include "SysTick_Delay.h"
+#include "GPIO_Pins.h"
+#include "Format.h"
+
+// Number of digits of the Seven-Segment Display module
+#define SEVEN_SEGMENT_DISPLAY_DIGITS 4
+
+// Interval between two Timer 4A interrupts in microseconds (one digit is written per interrupt)
+#define SEVEN_SEGMENT_REFRESH_PERIOD_US 1000
+
+// Segment pattern of a digit with every segment off (the segments are active low)
+#define SEVEN_SEGMENT_BLANK_PATTERN 0xFF
+
+// Number of brightness levels (0 = dimmest, 31 = each digit lit for its whole slot)
+#define SEVEN_SEGMENT_BRIGHTNESS_LEVELS 32
+
+// Smoothing of the light sensor readings used by Seven_Segment_Auto_Brightness
+// Each reading moves the filtered value by 1 / 2^4 of the difference, so with a reading every 10 ms
+// the brightness settles about 0.5 s after a change of the ambient light
+#define SEVEN_SEGMENT_LIGHT_FILTER_SHIFT 4
 
 extern const uint8_t number_pattern[16];
 
@@ -22,18 +58,23 @@ extern const uint8_t number_pattern[16];
  * This function initializes the pins connected to the shift register ICs that will communicate
  * with the Seven-Segment Display module on the EduBase board. It configures the
  * Synchronous Serial Interface 2 (SSI2) peripheral to operate in SPI mode.
+ * Then, it starts the Timer 4A interrupt that refreshes the digits in the background.
+ * The display is blank until a value is set.
  *
  * @param None
  *
  * @return None
  *
- * @note Assumes that a 16 MHz clock is used.
+ * @note Assumes that a 50 MHz clock is used.
  */
 void Seven_Segment_Display_Init(void);
 
 /**
  * @brief Transmits data using the SSI2 module.
  *
+ * @note The Timer 4A interrupt also writes to SSI2, so this function must not be used
+ * while the display is being refreshed.
+ *
  * This function writes the specified data to the Transmit Buffer of the SSI2 peripheral.
  * It asserts the slave select pin, writes the data to the SSI data register, waits for the data transmission to complete,
  * and then deasserts the slave select pin.
@@ -48,23 +89,36 @@ void SSI2_Write(uint8_t data);
  * @brief Counts the number of digits in an integer value.
  *
  * This function counts the number of digits in the specified integer value.
- * It repeatedly divides the value by 10 until it becomes zero, incrementing a counter for each division.
- * The final counter value represents the number of digits in the original value.
+ * It converts the magnitude of the value to packed BCD digits with Format_BCD
+ * and counts the significant digits, so it does not execute any hardware divides.
  *
  * @param value The integer value for which the number of digits is to be counted.
  *
- * @return The number of digits in the specified integer value.
+ * @return The number of digits in the specified integer value (0 for zero).
  */
 int Count_Digits(int value);
 
+/**
+ * @brief Sets the value displayed on the Seven-Segment Display module on the EduBase board.
+ *
+ * This function converts the value to packed BCD digits with Format_BCD and stores the corresponding
+ * pattern from the number_pattern array for each digit in the display buffer. It returns immediately,
+ * and the new value is displayed by the next refresh of each digit.
+ * Only the four least significant digits are displayed, and the leading zeros are blank.
+ *
+ * @param value The decimal number to be displayed on the Seven-Segment Display module.
+ *
+ * @return None
+ */
+void Seven_Segment_Set_Value(uint32_t value);
+
 /**
  * @brief Displays a value in decimal representation on the Seven-Segment Display module on the EduBase board.
  *
- * This function displays the specified number in decimal representation on the Seven-Segment Display module.
- * It calculates the number of digits in the value, extracts each digit, retrieves the corresponding pattern from
- * the number_pattern array, and writes the pattern to the seven-segment display sequentially.
+ * This function is equivalent to Seven_Segment_Set_Value. It no longer needs to be called
+ * in a loop, since the digits are refreshed by the Timer 4A interrupt.
  *
- * @param count_value The decimal number to be displayed on the Seven-Segment Display module.
+ * @param count_value The non-negative decimal number to be displayed on the Seven-Segment Display module.
  *
  * @return None
  */
@@ -73,16 +127,53 @@ void Seven_Segment_Display(int count_value);
 /**
  * @brief Displays the stopwatch value on a seven-segment display.
  *
- * This function displays the stopwatch value, represented by an array of integers,
- * on a seven-segment display. It writes the corresponding pattern for each digit of 
- * the stopwatch value. If a digit is 0, it displays "0" on the segment. Otherwise, it 
- * displays the corresponding digit. It provides a short delay (1 ms) between each
- * segment update.
+ * This function stores the pattern of each digit of the stopwatch value, represented by an array
+ * of integers, in the display buffer and returns immediately. Unlike Seven_Segment_Set_Value,
+ * the zeros are displayed.
  *
  * @param stopwatch_value An array of integers representing the stopwatch value.
- *                        Each integer corresponds to a digit of the stopwatch value.
- *                        The array must have a length of 8.
+ *                        Each integer (0 - 15) corresponds to a digit of the stopwatch value,
+ *                        starting from the rightmost digit. The array must have a length of 4.
  *
  * @return None
  */
 void Seven_Segment_Display_Stopwatch(uint8_t stopwatch_value[]);
+
+/**
+ * @brief Sets the brightness of the Seven-Segment Display module.
+ *
+ * The new level is applied from the next digit that is lit.
+ *
+ * @param level The brightness level (0 - SEVEN_SEGMENT_BRIGHTNESS_LEVELS - 1). Larger values are limited
+ *              to the brightest level.
+ *
+ * @return None
+ */
+void Seven_Segment_Set_Brightness(uint8_t level);
+
+/**
+ * @brief Adjusts the brightness of the Seven-Segment Display module to the ambient light.
+ *
+ * This function filters the light sensor readings with an exponential moving average and sets
+ * the brightness level in proportion to the filtered reading, so the display is dimmed in a dark
+ * environment without visible steps. It is meant to be called each time the sensor is sampled.
+ *
+ * @param light_sample The raw 12-bit reading of the light sensor (see Sample_Analog_Sensors_Raw).
+ *
+ * @return None
+ */
+void Seven_Segment_Auto_Brightness(uint16_t light_sample);
+
+/**
+ * @brief The interrupt service routine (ISR) for Timer 4A.
+ *
+ * This function latches the bytes that were queued by the previous interrupt. Then, it either
+ * queues the blank pattern, which ends the lit part of the slot of the current digit, or queues the
+ * pattern of the next digit from the display buffer in the SSI2 transmit FIFO. Finally, it starts
+ * Timer 4A with the length of the next phase.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void TIMER4A_Handler(void);
@@ -0,0 +1,424 @@
+/**
+ * @file Song_Stream.c
+ *
+ * @brief Source code for the Song_Stream driver.
+ *
+ * This file contains the function definitions for the Song_Stream driver.
+ * It receives RTTTL or binary songs through UART0 and plays them with the Music_Player driver
+ * while they are still arriving.
+ *
+ * @author Aaron Nanas
+ */
+
+#include "Song_Stream.h"
+
+// States of the parser
+#define STREAM_IDLE                 0
+#define STREAM_RTTTL_NAME           1
+#define STREAM_RTTTL_DEFAULTS       2
+#define STREAM_RTTTL_NOTES          3
+#define STREAM_BINARY_OPCODE        4
+#define STREAM_BINARY_OPERAND       5
+
+// Default values of an RTTTL song when they are not specified
+#define RTTTL_DEFAULT_DURATION      4
+#define RTTTL_DEFAULT_OCTAVE        6
+#define RTTTL_DEFAULT_BPM           63
+
+// Lowest tempo of an RTTTL song in beats per minute
+// A whole note then lasts 60 s, which fits in 255 ticks of at most 255 ms (the range of the TEMPO operand)
+#define RTTTL_MIN_BPM               4
+
+// Highest octave of an RTTTL note (the MIDI note range ends at G9)
+#define RTTTL_MAX_OCTAVE            9
+
+static uint8_t parser_state = STREAM_IDLE;
+
+// Chunks of events (2 bytes per event) that are queued in the music player
+static uint8_t chunks[2][SONG_STREAM_CHUNK_EVENTS * 2];
+
+// Chunk that is being filled, and the number of events written to it (0 if it has not been started)
+static uint8_t fill_chunk = 0;
+static uint8_t fill_events = 0;
+
+// Length of a tick in milliseconds, written at the start of each chunk
+static uint8_t stream_tick_ms = SONG_DEFAULT_TICK_MS;
+
+// Indicates whether the XOFF character has been sent to the sender
+static uint8_t flow_stopped = 0;
+
+// Default values of the RTTTL song and the default value that is being parsed
+static uint8_t default_duration = RTTTL_DEFAULT_DURATION;
+static uint8_t default_octave = RTTTL_DEFAULT_OCTAVE;
+static uint16_t beats_per_minute = RTTTL_DEFAULT_BPM;
+static char default_key = 0;
+static uint16_t default_value = 0;
+
+// Length of a whole note of the RTTTL song in milliseconds
+static uint32_t whole_note_ms = 0;
+
+// Fields of the RTTTL note that is being parsed
+static uint8_t note_duration = 0;
+static char note_letter = 0;
+static uint8_t note_sharp = 0;
+static uint8_t note_dotted = 0;
+static uint8_t note_octave = 0;
+
+// First byte of the binary event that is being received
+static uint8_t binary_opcode = 0;
+
+// Semitone of each RTTTL note letter ('a' to 'g') relative to C
+static const uint8_t rtttl_semitones[7] = {9, 11, 0, 2, 4, 5, 7};
+
+static void Song_Stream_Queue_Chunk(void)
+{
+	// Terminate the chunk and queue it in the music player
+	chunks[fill_chunk][fill_events * 2] = SONG_OPCODE_END;
+	chunks[fill_chunk][(fill_events * 2) + 1] = 0;
+	Music_Player_Queue(chunks[fill_chunk]);
+
+	// Fill the other chunk next
+	fill_chunk ^= 1;
+	fill_events = 0;
+}
+
+static void Song_Stream_Emit(uint8_t opcode, uint8_t operand)
+{
+	// Start the chunk with the current tempo
+	if (fill_events == 0)
+	{
+		chunks[fill_chunk][0] = SONG_OPCODE_TEMPO;
+		chunks[fill_chunk][1] = stream_tick_ms;
+		fill_events = 1;
+	}
+
+	chunks[fill_chunk][fill_events * 2] = opcode;
+	chunks[fill_chunk][(fill_events * 2) + 1] = operand;
+	fill_events++;
+
+	// Queue the chunk once it is full (the last event is reserved for SONG_END)
+	if (fill_events == (SONG_STREAM_CHUNK_EVENTS - 1))
+	{
+		Song_Stream_Queue_Chunk();
+	}
+}
+
+static void Song_Stream_End_Song(void)
+{
+	if (fill_events > 0)
+	{
+		Song_Stream_Queue_Chunk();
+	}
+
+	parser_state = STREAM_IDLE;
+}
+
+static void Song_Stream_Emit_RTTTL_Note(void)
+{
+	if (note_letter == 0)
+	{
+		return;
+	}
+
+	uint8_t duration = (note_duration != 0) ? note_duration : default_duration;
+	uint8_t octave = (note_octave != 0) ? note_octave : default_octave;
+	uint32_t duration_ms = whole_note_ms / duration;
+
+	if (note_dotted)
+	{
+		duration_ms += duration_ms / 2;
+	}
+
+	uint8_t opcode = SONG_OPCODE_REST;
+
+	if (note_letter != 'p')
+	{
+		uint32_t note = ((octave + 1) * 12) + rtttl_semitones[note_letter - 'a'] + note_sharp;
+
+		// The notes above the MIDI note range (G9) would be read as the rest, tempo, or end opcodes,
+		// so they are replaced with a rest of the same duration to keep the rhythm of the song
+		if (note < SONG_OPCODE_REST)
+		{
+			opcode = note;
+		}
+	}
+
+	// Round the duration to the nearest tick. A dotted whole note can exceed 255 ticks,
+	// so it is split into two events.
+	uint32_t ticks = (duration_ms + (stream_tick_ms / 2)) / stream_tick_ms;
+
+	if (ticks == 0)
+	{
+		ticks = 1;
+	}
+
+	if (ticks > 255)
+	{
+		Song_Stream_Emit(opcode, 255);
+		ticks -= 255;
+	}
+
+	Song_Stream_Emit(opcode, ticks);
+
+	note_duration = 0;
+	note_letter = 0;
+	note_sharp = 0;
+	note_dotted = 0;
+	note_octave = 0;
+}
+
+static void Song_Stream_Parse_Defaults(char character)
+{
+	if ((character >= '0') && (character <= '9'))
+	{
+		default_value = (default_value * 10) + (character - '0');
+	}
+	else if ((character == ',') || (character == ':'))
+	{
+		if ((default_key == 'd') && (default_value != 0) && (default_value <= 255))
+		{
+			default_duration = default_value;
+		}
+		else if ((default_key == 'o') && (default_value != 0) && (default_value <= RTTTL_MAX_OCTAVE))
+		{
+			default_octave = default_value;
+		}
+		else if ((default_key == 'b') && (default_value != 0))
+		{
+			// Slower tempos would need a tick longer than 255 ms
+			beats_per_minute = (default_value < RTTTL_MIN_BPM) ? RTTTL_MIN_BPM : default_value;
+		}
+
+		default_key = 0;
+		default_value = 0;
+
+		if (character == ':')
+		{
+			// A whole note lasts four beats. The tick is the shortest one that fits a whole note in a single event.
+			whole_note_ms = 240000 / beats_per_minute;
+			stream_tick_ms = (whole_note_ms + 254) / 255;
+
+			if (stream_tick_ms == 0)
+			{
+				stream_tick_ms = 1;
+			}
+
+			parser_state = STREAM_RTTTL_NOTES;
+		}
+	}
+	else if ((character == 'd') || (character == 'o') || (character == 'b'))
+	{
+		default_key = character;
+	}
+}
+
+static void Song_Stream_Parse_Note(char character)
+{
+	// Convert uppercase letters to lowercase
+	if ((character >= 'A') && (character <= 'Z'))
+	{
+		character = character + ('a' - 'A');
+	}
+
+	if ((character >= '0') && (character <= '9'))
+	{
+		// The digits before the note letter are the duration, and the digit after it is the octave
+		if (note_letter == 0)
+		{
+			note_duration = (note_duration * 10) + (character - '0');
+		}
+		else
+		{
+			note_octave = character - '0';
+		}
+	}
+	else if (((character >= 'a') && (character <= 'g')) || (character == 'p'))
+	{
+		note_letter = character;
+	}
+	else if (character == '#')
+	{
+		note_sharp = 1;
+	}
+	else if (character == '.')
+	{
+		note_dotted = 1;
+	}
+	else if (character == ',')
+	{
+		Song_Stream_Emit_RTTTL_Note();
+	}
+	else if ((character == UART0_CR) || (character == UART0_LF))
+	{
+		Song_Stream_Emit_RTTTL_Note();
+		Song_Stream_End_Song();
+	}
+}
+
+static void Song_Stream_Parse(uint8_t character)
+{
+	switch (parser_state)
+	{
+		case STREAM_IDLE:
+		{
+			if (character == SONG_STREAM_BINARY_MAGIC)
+			{
+				stream_tick_ms = SONG_DEFAULT_TICK_MS;
+				parser_state = STREAM_BINARY_OPCODE;
+			}
+			else if ((character != UART0_CR) && (character != UART0_LF) && (character != UART0_SP))
+			{
+				// Start an RTTTL song with the default values
+				default_duration = RTTTL_DEFAULT_DURATION;
+				default_octave = RTTTL_DEFAULT_OCTAVE;
+				beats_per_minute = RTTTL_DEFAULT_BPM;
+				default_key = 0;
+				default_value = 0;
+				note_duration = 0;
+				note_letter = 0;
+				note_sharp = 0;
+				note_dotted = 0;
+				note_octave = 0;
+				parser_state = (character == ':') ? STREAM_RTTTL_DEFAULTS : STREAM_RTTTL_NAME;
+			}
+		}
+		break;
+
+		case STREAM_RTTTL_NAME:
+		{
+			if (character == ':')
+			{
+				parser_state = STREAM_RTTTL_DEFAULTS;
+			}
+			else if ((character == UART0_CR) || (character == UART0_LF))
+			{
+				parser_state = STREAM_IDLE;
+			}
+		}
+		break;
+
+		case STREAM_RTTTL_DEFAULTS:
+		{
+			if ((character == UART0_CR) || (character == UART0_LF))
+			{
+				parser_state = STREAM_IDLE;
+			}
+			else
+			{
+				Song_Stream_Parse_Defaults(character);
+			}
+		}
+		break;
+
+		case STREAM_RTTTL_NOTES:
+		{
+			Song_Stream_Parse_Note(character);
+		}
+		break;
+
+		case STREAM_BINARY_OPCODE:
+		{
+			if (character == SONG_OPCODE_END)
+			{
+				Song_Stream_End_Song();
+			}
+			else
+			{
+				binary_opcode = character;
+				parser_state = STREAM_BINARY_OPERAND;
+			}
+		}
+		break;
+
+		case STREAM_BINARY_OPERAND:
+		{
+			// A tick of 0 ms would give every later event a duration of 0, so such a TEMPO event is dropped
+			if (binary_opcode == SONG_OPCODE_TEMPO)
+			{
+				if (character != 0)
+				{
+					stream_tick_ms = character;
+					Song_Stream_Emit(binary_opcode, character);
+				}
+			}
+			else
+			{
+				Song_Stream_Emit(binary_opcode, character);
+			}
+			parser_state = STREAM_BINARY_OPCODE;
+		}
+		break;
+	}
+}
+
+static uint8_t Song_Stream_Chunk_Available(void)
+{
+	// A character produces at most two events, so queue the chunk early
+	// when there is no room left for two events
+	if (fill_events > (SONG_STREAM_CHUNK_EVENTS - 3))
+	{
+		Song_Stream_Queue_Chunk();
+	}
+
+	// A new chunk can only be started once the music player has finished playing it.
+	// Since the chunks are queued one after the other, this is the case when at most
+	// one song (the other chunk) is left in the music player.
+	return (fill_events != 0) || (Music_Player_Get_Pending_Songs() <= 1);
+}
+
+static void Song_Stream_Poll(void)
+{
+	while (1)
+	{
+		// Pause the sender while both chunks are in use
+		if (!Song_Stream_Chunk_Available())
+		{
+			if (!flow_stopped)
+			{
+				UART0_Output_Character(SONG_STREAM_XOFF);
+				flow_stopped = 1;
+			}
+			return;
+		}
+
+		if (flow_stopped)
+		{
+			UART0_Output_Character(SONG_STREAM_XON);
+			flow_stopped = 0;
+		}
+
+		char character;
+
+		if (UART0_Read(&character, 1) == 0)
+		{
+			break;
+		}
+
+		Song_Stream_Parse(character);
+	}
+
+	// Start playing the events that have been received so far
+	// when the music player has nothing left to play
+	if ((fill_events > 1) && (Music_Player_Get_Pending_Songs() == 0))
+	{
+		Song_Stream_Queue_Chunk();
+	}
+}
+
+void Song_Stream_Init(void)
+{
+	parser_state = STREAM_IDLE;
+	fill_chunk = 0;
+	fill_events = 0;
+	flow_stopped = 0;
+
+	// Read the received characters every 1 ms
+	// At 115200 baud, at most 12 characters are received in 1 ms, and the UART0 interrupt
+	// keeps up to UART0_RX_BUFFER_SIZE characters in the receive ring buffer between two polls
+	Timer_Wheel_Arm(1, 1, &Song_Stream_Poll);
+}
+
+uint8_t Song_Stream_Is_Receiving(void)
+{
+	return (parser_state != STREAM_IDLE);
+}
@@ -0,0 +1,65 @@
+/**
+ * @file Song_Stream.h
+ *
+ * @brief Header file for the Song_Stream driver.
+ *
+ * This file contains the function definitions for the Song_Stream driver.
+ * It receives songs through UART0 and plays them with the Music_Player driver while they are still arriving.
+ *
+ * Two song formats are accepted:
+ *	- RTTTL text, for example "tetris:d=4,o=5,b=160:e6,8b,8c6,8d6,8c6,8b,a,8a,8c6,e6"
+ *	  The song ends with a carriage return or a line feed character.
+ *	- A binary stream that starts with the SONG_STREAM_BINARY_MAGIC byte and is followed by
+ *	  2-byte events in the packed song format (see Songs.h). The song ends with the SONG_END event.
+ *
+ * The received characters are read from a 1 ms timer wheel task and parsed one at a time.
+ * The parsed events are written to one of two chunks of SONG_STREAM_CHUNK_EVENTS events.
+ * Each chunk is queued in the music player once it is full, once the song has ended, or as soon as
+ * the music player has nothing left to play, so playback starts with the first received note.
+ * A chunk is filled again once the music player has finished playing it, so the memory used
+ * does not depend on the length of the song.
+ *
+ * When both chunks are in use, the driver sends the XOFF character to pause the sender and stops
+ * reading UART0, and it sends the XON character once a chunk is available again. The characters
+ * that the sender transmits after the XOFF character wait in the UART0 receive ring buffer.
+ *
+ * @note The UART0_Init, Timer_Wheel_Init and Music_Player_Init functions must be called before Song_Stream_Init.
+ * The music player must not be used to play other songs while a song is being received,
+ * so the applications check Song_Stream_Is_Receiving before they start a song.
+ *
+ * @author Aaron Nanas
+ */
+
+#include "TM4C123GH6PM.h"
+#include "UART0.h"
+#include "Timer_Wheel.h"
+#include "Music_Player.h"
+#include "Songs.h"
+
+// First byte of a binary song stream
+#define SONG_STREAM_BINARY_MAGIC    0xA5
+
+// Number of events stored in each of the two chunks
+#define SONG_STREAM_CHUNK_EVENTS    32
+
+// Software flow control characters
+#define SONG_STREAM_XON             0x11
+#define SONG_STREAM_XOFF            0x13
+
+/**
+ * @brief Initializes the song stream parser and starts reading UART0 every 1 ms.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Song_Stream_Init(void);
+
+/**
+ * @brief Indicates whether a song is being received.
+ *
+ * @param None
+ *
+ * @return 1 if the beginning of a song has been received and its end has not been received yet; Otherwise, 0.
+ */
+uint8_t Song_Stream_Is_Receiving(void);
@@ -0,0 +1,140 @@
+/**
+ * @file Songs.c
+ *
+ * @brief Source code for the Songs module.
+ *
+ * This file contains the songs that are stored in flash memory
+ * in the packed song format described in Songs.h.
+ *
+ * The durations were converted from the beep() calls that were previously used to play each song,
+ * where a note lasted (number of periods / frequency) seconds. The tick length of each song is the
+ * shortest one that fits its longest event in a single byte.
+ *
+ * @author Aaron Nanas
+ */
+
+#include "Songs.h"
+
+// Imperial March (Star Wars)
+const uint8_t imperial_march_song[] =
+{
+	SONG_TEMPO(3),
+	SONG_NOTE(NOTE_A4, 114), SONG_REST(2), SONG_NOTE(NOTE_A4, 114), SONG_REST(2),
+	SONG_NOTE(NOTE_A4, 114), SONG_REST(2), SONG_NOTE(NOTE_F4, 167), SONG_NOTE(NOTE_C5, 48),
+	SONG_NOTE(NOTE_A4, 114), SONG_NOTE(NOTE_F4, 167), SONG_NOTE(NOTE_C5, 48), SONG_NOTE(NOTE_A4, 246),
+	SONG_REST(50), SONG_NOTE(NOTE_E5, 76), SONG_NOTE(NOTE_E5, 76), SONG_NOTE(NOTE_E5, 76),
+	SONG_NOTE(NOTE_F5, 84), SONG_NOTE(NOTE_C5, 48), SONG_NOTE(NOTE_GS4, 120), SONG_NOTE(NOTE_F4, 167),
+	SONG_NOTE(NOTE_C5, 48), SONG_NOTE(NOTE_A4, 246), SONG_REST(50), SONG_NOTE(NOTE_A5, 57),
+	SONG_NOTE(NOTE_A4, 114), SONG_NOTE(NOTE_A4, 57), SONG_NOTE(NOTE_A5, 57), SONG_NOTE(NOTE_GS5, 70),
+	SONG_NOTE(NOTE_G5, 37), SONG_NOTE(NOTE_FS5, 28), SONG_NOTE(NOTE_F5, 30), SONG_NOTE(NOTE_FS5, 56),
+	SONG_REST(50), SONG_NOTE(NOTE_AS4, 92), SONG_NOTE(NOTE_DS5, 80), SONG_NOTE(NOTE_D5, 99),
+	SONG_NOTE(NOTE_CS5, 53), SONG_NOTE(NOTE_C5, 40), SONG_NOTE(NOTE_AS4, 45), SONG_NOTE(NOTE_C5, 80),
+	SONG_REST(50), SONG_NOTE(NOTE_F4, 167), SONG_NOTE(NOTE_GS4, 120), SONG_NOTE(NOTE_F4, 167),
+	SONG_NOTE(NOTE_A4, 48), SONG_NOTE(NOTE_C5, 96), SONG_NOTE(NOTE_A4, 142), SONG_NOTE(NOTE_C5, 40),
+	SONG_NOTE(NOTE_E5, 164), SONG_REST(50), SONG_NOTE(NOTE_A5, 57), SONG_NOTE(NOTE_A4, 114),
+	SONG_NOTE(NOTE_A4, 57), SONG_NOTE(NOTE_A5, 57), SONG_NOTE(NOTE_GS5, 65), SONG_NOTE(NOTE_G5, 37),
+	SONG_NOTE(NOTE_FS5, 28), SONG_NOTE(NOTE_F5, 30), SONG_NOTE(NOTE_FS5, 56), SONG_REST(50),
+	SONG_NOTE(NOTE_AS4, 92), SONG_NOTE(NOTE_DS5, 80), SONG_NOTE(NOTE_D5, 93), SONG_NOTE(NOTE_CS5, 53),
+	SONG_NOTE(NOTE_C5, 40), SONG_NOTE(NOTE_AS4, 45), SONG_NOTE(NOTE_C5, 80), SONG_REST(167),
+	SONG_NOTE(NOTE_F4, 119), SONG_NOTE(NOTE_GS4, 120), SONG_NOTE(NOTE_F4, 180), SONG_NOTE(NOTE_C5, 40),
+	SONG_NOTE(NOTE_A4, 114), SONG_NOTE(NOTE_F4, 180), SONG_NOTE(NOTE_C5, 40), SONG_NOTE(NOTE_A4, 246),
+	SONG_REST(167),
+	SONG_END
+};
+
+// Super Mario Bros Theme
+const uint8_t super_mario_bros_song[] =
+{
+	SONG_TEMPO(2),
+	SONG_NOTE(NOTE_E5, 76), SONG_REST(2), SONG_NOTE(NOTE_E5, 76), SONG_REST(2),
+	SONG_NOTE(NOTE_E5, 76), SONG_REST(2), SONG_NOTE(NOTE_C5, 96), SONG_NOTE(NOTE_E5, 76),
+	SONG_NOTE(NOTE_G5, 64), SONG_NOTE(NOTE_G4, 128), SONG_NOTE(NOTE_C5, 96), SONG_REST(2),
+	SONG_NOTE(NOTE_G4, 128), SONG_REST(3), SONG_NOTE(NOTE_E4, 152), SONG_REST(2),
+	SONG_NOTE(NOTE_A4, 114), SONG_REST(2), SONG_NOTE(NOTE_B4, 101), SONG_REST(2),
+	SONG_NOTE(NOTE_AS4, 107), SONG_NOTE(NOTE_A4, 114), SONG_NOTE(NOTE_G4, 128), SONG_NOTE(NOTE_E5, 76),
+	SONG_NOTE(NOTE_G5, 64), SONG_NOTE(NOTE_A5, 57), SONG_NOTE(NOTE_F5, 72), SONG_NOTE(NOTE_G5, 64),
+	SONG_REST(2), SONG_NOTE(NOTE_E5, 76), SONG_REST(2), SONG_NOTE(NOTE_C5, 96),
+	SONG_NOTE(NOTE_D5, 85), SONG_NOTE(NOTE_B4, 101), SONG_REST(3), SONG_NOTE(NOTE_C5, 96),
+	SONG_REST(2), SONG_NOTE(NOTE_G4, 128), SONG_REST(3), SONG_NOTE(NOTE_E4, 152),
+	SONG_REST(2), SONG_NOTE(NOTE_A4, 114), SONG_REST(2), SONG_NOTE(NOTE_B4, 101),
+	SONG_REST(2), SONG_NOTE(NOTE_AS4, 107), SONG_NOTE(NOTE_A4, 114), SONG_NOTE(NOTE_G4, 128),
+	SONG_NOTE(NOTE_E5, 76), SONG_NOTE(NOTE_G5, 64), SONG_NOTE(NOTE_A5, 57), SONG_NOTE(NOTE_F5, 72),
+	SONG_NOTE(NOTE_G5, 64), SONG_REST(2), SONG_NOTE(NOTE_E5, 76), SONG_REST(2),
+	SONG_NOTE(NOTE_C5, 96), SONG_NOTE(NOTE_D5, 85), SONG_NOTE(NOTE_B4, 10), SONG_REST(6),
+	SONG_NOTE(NOTE_G5, 64), SONG_NOTE(NOTE_FS5, 68), SONG_NOTE(NOTE_F5, 72), SONG_NOTE(NOTE_DS5, 80),
+	SONG_NOTE(NOTE_E5, 76), SONG_REST(2), SONG_NOTE(NOTE_GS4, 120), SONG_NOTE(NOTE_A4, 114),
+	SONG_NOTE(NOTE_C5, 96), SONG_REST(2), SONG_NOTE(NOTE_A4, 114), SONG_NOTE(NOTE_C5, 96),
+	SONG_NOTE(NOTE_D5, 85), SONG_REST(3), SONG_NOTE(NOTE_G5, 64), SONG_NOTE(NOTE_FS5, 68),
+	SONG_NOTE(NOTE_F5, 72), SONG_NOTE(NOTE_DS5, 80), SONG_NOTE(NOTE_E5, 76), SONG_REST(2),
+	SONG_NOTE(NOTE_C6, 48), SONG_REST(2), SONG_NOTE(NOTE_C6, 48), SONG_NOTE(NOTE_C6, 48),
+	SONG_REST(3), SONG_NOTE(NOTE_G5, 64), SONG_NOTE(NOTE_FS5, 68), SONG_NOTE(NOTE_F5, 72),
+	SONG_NOTE(NOTE_DS5, 80), SONG_NOTE(NOTE_E5, 76), SONG_REST(2), SONG_NOTE(NOTE_GS4, 120),
+	SONG_NOTE(NOTE_A4, 114), SONG_NOTE(NOTE_C5, 96), SONG_REST(2), SONG_NOTE(NOTE_A4, 114),
+	SONG_NOTE(NOTE_C5, 96), SONG_NOTE(NOTE_D5, 85), SONG_REST(3), SONG_NOTE(NOTE_DS5, 80),
+	SONG_REST(2), SONG_NOTE(NOTE_D5, 85), SONG_REST(3), SONG_NOTE(NOTE_C5, 96),
+	SONG_REST(6),
+	SONG_END
+};
+
+// Tetris Theme (Korobeiniki)
+const uint8_t tetris_song[] =
+{
+	SONG_TEMPO(2),
+	SONG_NOTE(NOTE_E5, 76), SONG_NOTE(NOTE_B4, 202), SONG_NOTE(NOTE_C5, 191), SONG_NOTE(NOTE_D5, 85),
+	SONG_NOTE(NOTE_C5, 191), SONG_NOTE(NOTE_B4, 202), SONG_NOTE(NOTE_A4, 114), SONG_NOTE(NOTE_A4, 227),
+	SONG_NOTE(NOTE_C5, 191), SONG_NOTE(NOTE_E5, 76), SONG_NOTE(NOTE_D5, 170), SONG_NOTE(NOTE_C5, 191),
+	SONG_NOTE(NOTE_B4, 101), SONG_NOTE(NOTE_C5, 191), SONG_NOTE(NOTE_D5, 85), SONG_NOTE(NOTE_E5, 76),
+	SONG_NOTE(NOTE_C5, 96), SONG_NOTE(NOTE_A4, 114), SONG_NOTE(NOTE_A4, 227), SONG_NOTE(NOTE_A4, 114),
+	SONG_NOTE(NOTE_B4, 202), SONG_NOTE(NOTE_C5, 191), SONG_NOTE(NOTE_D5, 85), SONG_NOTE(NOTE_F5, 143),
+	SONG_NOTE(NOTE_A5, 57), SONG_NOTE(NOTE_G5, 128), SONG_NOTE(NOTE_F5, 143), SONG_NOTE(NOTE_E5, 76),
+	SONG_NOTE(NOTE_C5, 191), SONG_NOTE(NOTE_E5, 76), SONG_NOTE(NOTE_D5, 170), SONG_NOTE(NOTE_C5, 191),
+	SONG_NOTE(NOTE_B4, 101), SONG_NOTE(NOTE_B4, 202), SONG_NOTE(NOTE_C5, 191), SONG_NOTE(NOTE_D5, 85),
+	SONG_NOTE(NOTE_E5, 76), SONG_NOTE(NOTE_C5, 96), SONG_NOTE(NOTE_A4, 114), SONG_NOTE(NOTE_A4, 114),
+	SONG_REST(50), SONG_NOTE(NOTE_E5, 76), SONG_NOTE(NOTE_B4, 202), SONG_NOTE(NOTE_C5, 191),
+	SONG_NOTE(NOTE_D5, 85), SONG_NOTE(NOTE_C5, 191), SONG_NOTE(NOTE_B4, 202), SONG_NOTE(NOTE_A4, 114),
+	SONG_NOTE(NOTE_A4, 227), SONG_NOTE(NOTE_C5, 191), SONG_NOTE(NOTE_E5, 76), SONG_NOTE(NOTE_D5, 170),
+	SONG_NOTE(NOTE_C5, 191), SONG_NOTE(NOTE_B4, 101), SONG_NOTE(NOTE_C5, 191), SONG_NOTE(NOTE_D5, 85),
+	SONG_NOTE(NOTE_E5, 76), SONG_NOTE(NOTE_C5, 96), SONG_NOTE(NOTE_A4, 114), SONG_NOTE(NOTE_A4, 227),
+	SONG_NOTE(NOTE_A4, 114), SONG_NOTE(NOTE_B4, 202), SONG_NOTE(NOTE_C5, 191), SONG_NOTE(NOTE_D5, 85),
+	SONG_NOTE(NOTE_F5, 143), SONG_NOTE(NOTE_A5, 57), SONG_NOTE(NOTE_G5, 128), SONG_NOTE(NOTE_F5, 143),
+	SONG_NOTE(NOTE_E5, 76), SONG_NOTE(NOTE_C5, 191), SONG_NOTE(NOTE_E5, 76), SONG_NOTE(NOTE_D5, 170),
+	SONG_NOTE(NOTE_C5, 191), SONG_NOTE(NOTE_B4, 101), SONG_NOTE(NOTE_B4, 202), SONG_NOTE(NOTE_C5, 191),
+	SONG_NOTE(NOTE_D5, 85), SONG_NOTE(NOTE_E5, 76), SONG_NOTE(NOTE_C5, 96), SONG_NOTE(NOTE_A4, 114),
+	SONG_NOTE(NOTE_A4, 114), SONG_REST(50), SONG_NOTE(NOTE_E5, 38), SONG_NOTE(NOTE_C5, 48),
+	SONG_NOTE(NOTE_D5, 43), SONG_NOTE(NOTE_B4, 51), SONG_NOTE(NOTE_C5, 48), SONG_NOTE(NOTE_A4, 57),
+	SONG_NOTE(NOTE_GS4, 60), SONG_NOTE(NOTE_B4, 101), SONG_REST(100), SONG_NOTE(NOTE_E5, 38),
+	SONG_NOTE(NOTE_C5, 48), SONG_NOTE(NOTE_D5, 43), SONG_NOTE(NOTE_B4, 51), SONG_NOTE(NOTE_C5, 96),
+	SONG_NOTE(NOTE_E5, 76), SONG_NOTE(NOTE_A5, 28), SONG_NOTE(NOTE_GS5, 30),
+	SONG_END
+};
+
+// Aha - Take On Me
+const uint8_t take_on_me_song[] =
+{
+	SONG_TEMPO(1),
+	SONG_NOTE(NOTE_FS5, 135), SONG_NOTE(NOTE_FS5, 135), SONG_NOTE(NOTE_D5, 170), SONG_NOTE(NOTE_B4, 202),
+	SONG_REST(100), SONG_NOTE(NOTE_B4, 202), SONG_REST(100), SONG_NOTE(NOTE_E5, 152),
+	SONG_REST(100), SONG_NOTE(NOTE_E5, 152), SONG_REST(100), SONG_NOTE(NOTE_E5, 152),
+	SONG_NOTE(NOTE_GS5, 120), SONG_NOTE(NOTE_GS5, 120), SONG_NOTE(NOTE_A5, 114), SONG_NOTE(NOTE_B5, 101),
+	SONG_NOTE(NOTE_A5, 114), SONG_NOTE(NOTE_A5, 114), SONG_NOTE(NOTE_A5, 114), SONG_NOTE(NOTE_E5, 152),
+	SONG_REST(100), SONG_NOTE(NOTE_D5, 170), SONG_REST(100), SONG_NOTE(NOTE_FS5, 135),
+	SONG_REST(100), SONG_NOTE(NOTE_FS5, 135), SONG_REST(100), SONG_NOTE(NOTE_FS5, 135),
+	SONG_NOTE(NOTE_E5, 152), SONG_NOTE(NOTE_E5, 152), SONG_NOTE(NOTE_FS5, 135), SONG_NOTE(NOTE_E5, 152),
+	SONG_NOTE(NOTE_FS5, 135), SONG_NOTE(NOTE_FS5, 135), SONG_NOTE(NOTE_D5, 170), SONG_NOTE(NOTE_B4, 202),
+	SONG_REST(100), SONG_NOTE(NOTE_B4, 202), SONG_REST(100), SONG_NOTE(NOTE_E5, 152),
+	SONG_REST(100), SONG_NOTE(NOTE_E5, 152), SONG_REST(100), SONG_NOTE(NOTE_E5, 152),
+	SONG_NOTE(NOTE_GS5, 120), SONG_NOTE(NOTE_GS5, 120), SONG_NOTE(NOTE_A5, 114), SONG_NOTE(NOTE_B5, 101),
+	SONG_NOTE(NOTE_A5, 114), SONG_NOTE(NOTE_A5, 114), SONG_NOTE(NOTE_A5, 114), SONG_NOTE(NOTE_E5, 152),
+	SONG_REST(100), SONG_NOTE(NOTE_D5, 170), SONG_REST(100), SONG_NOTE(NOTE_FS5, 135),
+	SONG_REST(100), SONG_NOTE(NOTE_FS5, 135), SONG_REST(100), SONG_NOTE(NOTE_FS5, 135),
+	SONG_NOTE(NOTE_E5, 152), SONG_NOTE(NOTE_E5, 152), SONG_NOTE(NOTE_FS5, 135), SONG_NOTE(NOTE_E5, 152),
+	SONG_NOTE(NOTE_FS5, 135), SONG_NOTE(NOTE_FS5, 135), SONG_NOTE(NOTE_D5, 170), SONG_NOTE(NOTE_B4, 202),
+	SONG_REST(100), SONG_NOTE(NOTE_B4, 202), SONG_REST(100), SONG_NOTE(NOTE_E5, 152),
+	SONG_REST(100), SONG_NOTE(NOTE_E5, 152), SONG_REST(100), SONG_NOTE(NOTE_E5, 152),
+	SONG_NOTE(NOTE_GS5, 120), SONG_NOTE(NOTE_GS5, 120), SONG_NOTE(NOTE_A5, 114), SONG_NOTE(NOTE_B5, 101),
+	SONG_NOTE(NOTE_A5, 114), SONG_NOTE(NOTE_A5, 114), SONG_NOTE(NOTE_A5, 114), SONG_NOTE(NOTE_E5, 152),
+	SONG_REST(100), SONG_NOTE(NOTE_D5, 170), SONG_REST(100), SONG_NOTE(NOTE_FS5, 135),
+	SONG_REST(100), SONG_NOTE(NOTE_FS5, 135), SONG_REST(100), SONG_NOTE(NOTE_FS5, 135),
+	SONG_NOTE(NOTE_E5, 152), SONG_NOTE(NOTE_E5, 152), SONG_NOTE(NOTE_FS5, 135), SONG_NOTE(NOTE_E5, 152),
+	SONG_END
+};
@@ -0,0 +1,48 @@
+/**
+ * @file Songs.h
+ *
+ * @brief Header file for the Songs module.
+ *
+ * This file defines the packed song format used by the Music_Player driver and declares
+ * the songs that are stored in flash memory.
+ *
+ * A song is a constant array of 2-byte events that is terminated by SONG_END:
+ *	- SONG_NOTE(note, ticks): Plays a note for the specified number of ticks.
+ *	  The note is a MIDI note number (NOTE_C0 - NOTE_B8, defined in Tone.h).
+ *	- SONG_REST(ticks): Silences the buzzer for the specified number of ticks.
+ *	- SONG_TEMPO(ms): Sets the length of a tick in milliseconds for the following events.
+ *	- SONG_END: Marks the end of the song.
+ *
+ * The first byte of an event holds the note number (0 - 127) or an opcode (128 - 255),
+ * and the second byte holds the duration or the operand of the opcode.
+ *
+ * @author Aaron Nanas
+ */
+
+#ifndef SONGS_H
+#define SONGS_H
+
+#include "TM4C123GH6PM.h"
+#include "Tone.h"
+
+// Opcodes of the packed song format
+#define SONG_OPCODE_REST        0x80
+#define SONG_OPCODE_TEMPO       0x81
+#define SONG_OPCODE_END         0xFF
+
+// Length of a tick in milliseconds until the first SONG_TEMPO event
+#define SONG_DEFAULT_TICK_MS    10
+
+// Macros used to write the events of a song
+#define SONG_NOTE(note, ticks)  (note), (ticks)
+#define SONG_REST(ticks)        SONG_OPCODE_REST, (ticks)
+#define SONG_TEMPO(ms)          SONG_OPCODE_TEMPO, (ms)
+#define SONG_END                SONG_OPCODE_END, 0
+
+// Songs stored in flash memory
+extern const uint8_t imperial_march_song[];
+extern const uint8_t super_mario_bros_song[];
+extern const uint8_t tetris_song[];
+extern const uint8_t take_on_me_song[];
+
+#endif
@@ -1,62 +1,63 @@
+/**
+ * @file SysTick_Delay.c
+ *
+ * @brief Source code for the SysTick_Delay driver.
+ *
+ * It provides two blocking functions, SysTick_Delay1ms and SysTick_Delay1us,
+ * to create a delay with a busy-wait loop. The delays are measured with the
+ * free-running Data Watchpoint and Trace (DWT) cycle counter, so no interrupts
+ * are generated while waiting.
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz.
+ */
 
 #include "SysTick_Delay.h"
 
-// Global variable used to keep track of elapsed time in microseconds
-static uint32_t us_elapsed = 0;
-
-// Global variable used to keep track of elapsed time in milliseconds
-static uint32_t ms_elapsed = 0;
-
-// Global flag used to indicate if milliseconds delay is active
-static uint8_t ms_active = 0;
-
 void SysTick_Delay_Init(void)
-{	
-	// Set the SysTick timer reload value for 1 ms intervals
-	SysTick->LOAD = (4 - 1);
-	
-	// Enable the SysTick timer and its interrupt
-	// with the Peripheral Internal Oscillator (PIOSC) as the clock source
-	SysTick->CTRL |= 0x03;
+{
+	// Disable the SysTick timer and its interrupt in case it was
+	// previously configured to generate 1 us interrupts
+	SysTick->CTRL = 0x00;
+
+	// Enable the DWT and ITM units by setting the
+	// TRCENA bit (Bit 24) in the Debug Exception and Monitor Control Register (DEMCR)
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+
+	// Reset the cycle counter and start it by setting
+	// the CYCCNTENA bit (Bit 0) in the DWT Control Register
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
 }
 
 void SysTick_Delay1us(uint32_t delay_in_us)
 {
-	// Reset the global variable, us_elapsed
-	us_elapsed = 0;
-	
-	// Wait until ms_value reaches the specified delay_in_ms
-	while (delay_in_us > us_elapsed);
+	// Capture the cycle counter at the start of the delay
+	uint32_t start_cycles = DWT->CYCCNT;
+
+	// Convert the requested delay into system clock cycles
+	uint32_t delay_in_cycles = delay_in_us * SYSTICK_DELAY_CYCLES_PER_US;
+
+	// Wait until the number of elapsed cycles reaches the requested delay
+	// The unsigned subtraction remains correct when CYCCNT wraps around
+	while ((DWT->CYCCNT - start_cycles) < delay_in_cycles);
 }
 
 void SysTick_Delay1ms(uint32_t delay_in_ms)
 {
-	// Reset the global variables, us_elapsed and ms_elapsed
-	us_elapsed = 0;
-	ms_elapsed = 0;
-	
-	// Set the ms_active global flag
-	ms_active = 0x01;
-	
-	// Wait until ms_elapsed reaches the specified delay_in_ms
-	while (delay_in_ms > ms_elapsed);
-	
-	// Reset the ms_active global flag
-	ms_active = 0x00;
-}
+	// Capture the cycle counter at the start of the delay
+	uint32_t deadline = DWT->CYCCNT;
 
-void SysTick_Handler(void)
-{
-	// Increment the global variable, us_elapsed
-	us_elapsed = us_elapsed + 1;
-	
-	// Check if us_elapsed has reached 1000 (1 millisecond) and if milliseconds delay is active
-	if (us_elapsed == 1000 && (ms_active == 0x01))
+	// Wait for one millisecond at a time so that long delays
+	// do not overflow the 32-bit cycle count
+	while (delay_in_ms > 0)
 	{
-		// Reset us_elapsed
-		us_elapsed = 0;
-		
-		// Increment ms_elapsed to indicate that 1 millisecond has passed
-		ms_elapsed = ms_elapsed + 1;
+		// Advance the deadline by one millisecond worth of cycles
+		uint32_t start_cycles = deadline;
+		deadline = deadline + (1000 * SYSTICK_DELAY_CYCLES_PER_US);
+
+		// Wait until one millisecond has elapsed since the previous deadline
+		while ((DWT->CYCCNT - start_cycles) < (1000 * SYSTICK_DELAY_CYCLES_PER_US));
+
+		delay_in_ms = delay_in_ms - 1;
 	}
 }
@@ -4,25 +4,32 @@
  * @brief Header file for the SysTick_Delay driver.
  *
  * It provides two blocking functions, SysTick_Delay1ms and SysTick_Delay1us,
- * to create a delay with a busy-wait loop. It uses the SysTick timer with 
- * a specified reload value to generate interrupts every 1 us.
- * 
- * In addition, it uses the Peripheral Internal Oscillator (PIOSC) 
- * as the clock source. The PIOSC provides 16 MHz which is then divided by 4. 
- * The timer is used for creating delays in either microseconds or milliseconds.
+ * to create a delay with a busy-wait loop. The delays are measured with the
+ * free-running Data Watchpoint and Trace (DWT) cycle counter, which increments
+ * once per system clock cycle (50 MHz) without generating any interrupts.
+ *
+ * The previous implementation reloaded the SysTick timer every 1 us from the
+ * PIOSC, so SysTick_Handler ran one million times per second. With roughly 12 cycles
+ * of exception entry, 10 cycles of exit and about 12 cycles in the handler body,
+ * that cost ~34 of every 50 cycles (about 68% of the CPU) whether or not a delay
+ * was in progress. The DWT-based delays generate zero interrupts.
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz.
  *
  * @author Aaron Nanas
  */
- 
+
 #include "TM4C123GH6PM.h"
 
+// Number of DWT cycle counter ticks in one microsecond (50 MHz system clock)
+#define SYSTICK_DELAY_CYCLES_PER_US 50
+
 /**
- * @brief The SysTick_Delay_Init function initializes the SysTick timer to be used for a blocking delay function.
+ * @brief The SysTick_Delay_Init function initializes the cycle counter used for the blocking delay functions.
  *
- * This function configures the SysTick timer and its interrupt with a specified reload value to 
- * generate interrupts every 1 us. It uses the Peripheral Internal Oscillator (PIOSC) as the clock source.
- * The PIOSC provides 16 MHz which is then divided by 4. The timer is used for creating delays in either 
- * microseconds or milliseconds.
+ * This function enables the trace subsystem by setting the TRCENA bit in the DEMCR register
+ * and then starts the free-running DWT cycle counter (CYCCNT). No interrupts are enabled.
+ * The SysTick timer is left disabled so that it can be used by other drivers.
  *
  * @param None
  *
@@ -31,39 +38,26 @@
 void SysTick_Delay_Init(void);
 
 /**
- * @brief The SysTick_Delay1us function provides a blocking delay in microseconds using the SysTick timer.
+ * @brief The SysTick_Delay1us function provides a blocking delay in microseconds.
  *
- * This function resets the global variable, us_elapsed, to zero and waits until us_elapsed reaches 
- * the specified delay_in_us.
+ * This function captures the current value of the DWT cycle counter and waits until
+ * (delay_in_us * 50) cycles have elapsed. The unsigned subtraction handles the counter wrapping around.
  *
- * @param delay_in_us The delay time in microseconds.
+ * @param delay_in_us The delay time in microseconds. Delays up to 85,000,000 us are supported.
  *
  * @return None
  */
 void SysTick_Delay1us(uint32_t delay_in_us);
 
 /**
- * @brief The SysTick_Delay1ms function provides a blocking delay in milliseconds using the SysTick timer.
+ * @brief The SysTick_Delay1ms function provides a blocking delay in milliseconds.
  *
- * This function clears the global variables, us_elapsed and ms_elapsed, to zero and sets ms_active flag to 0x01 
- * indicating that milliseconds delay is active. It then waits until ms_elapsed reaches the specified delay_in_ms.
- * After the delay, it clears ms_active flag back to 0x00.
+ * This function waits for 50,000 cycles of the DWT cycle counter once for each millisecond
+ * in delay_in_ms. The deadline of each millisecond is advanced from the previous deadline
+ * rather than from the current time, so the delay does not drift for long values.
  *
  * @param delay_in_ms The delay time in milliseconds.
  *
  * @return None
  */
 void SysTick_Delay1ms(uint32_t delay_in_ms);
-
-/**
- * @brief The SysTick_Handler function is the interrupt service routine for the SysTick timer.
- *
- * This function is called whenever the SysTick timer generates an interrupt. It increments the global variable
- * us_elapsed by 1, indicating that 1 microsecond has passed. Additionally, if us_elapsed reaches 1000 and ms_active
- * flag is set to 0x01, it resets us_elapsed and increments ms_elapsed by 1, indicating that 1 millisecond has passed.
- *
- * @param None
- *
- * @return None
- */
-void SysTick_Handler(void);
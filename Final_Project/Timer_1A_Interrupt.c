@@ -49,10 +49,11 @@ void Timer_1A_Interrupt_Init(void(*task)(void))
 	// GPTMTAPR register before setting the prescale value
 	TIMER1->TAPR &= ~0x000000FF;
 	
-	// Set the prescale value to 50 by setting the bits of the 
+	// Set the prescale value to 49 by setting the bits of the 
 	// TAPSR field (Bits 7 to 0) in the GPTMTAPR register
-	// New timer clock frequency = (50 MHz / 50) = 1 MHz
-	TIMER1->TAPR |= 50;
+	// The timer clock is divided by (prescale value + 1)
+	// New timer clock frequency = (50 MHz / (49 + 1)) = 1 MHz
+	TIMER1->TAPR |= (50 - 1);
 	
 	// Set the timer interval load value by writing to the
 	// TAILR field (Bits 31 to 0) in the GPTMTAILR register
@@ -69,10 +70,9 @@ void Timer_1A_Interrupt_Init(void(*task)(void))
 	TIMER1->IMR |= 0x01;
 	
 	// Set the priority level to 1 for the Timer 1A interrupt
-	// In the Interrupt 20-23 Priority (PRI5) register,
-	// the INTB field (Bits 15 to 13) corresponds to Interrupt Request (IRQ) 21
-	// Timer 1A has an IRQ of 21
-	NVIC->IP[5] = (NVIC->IP[5] & 0xFFFF00FF) | (1 << 13);
+	// Timer 1A has an IRQ of 21, and its priority is stored in Bits 7 to 5 of the IP[21] byte,
+	// which is the INTB field (Bits 15 to 13) of the Interrupt 20-23 Priority (PRI5) register
+	NVIC->IP[21] = (1 << 5);
 	
 	// Enable IRQ 21 for Timer 1A by setting Bit 21 in the ISER[0] register
 	NVIC->ISER[0] |= (1 << 21);
@@ -0,0 +1,302 @@
+/**
+ * @file Timer_Wheel.c
+ *
+ * @brief Source code for the Timer_Wheel driver.
+ *
+ * This file contains the function definitions for the Timer_Wheel driver.
+ * It multiplexes one-shot and periodic software timers onto the 1 ms periodic
+ * interrupt generated by the Timer_1A_Interrupt driver using a three-level
+ * hierarchical timer wheel.
+ *
+ * @author Aaron Nanas
+ */
+
+#include "Timer_Wheel.h"
+
+// Number of slots in each level of the timer wheel
+#define LEVEL_0_BITS    8
+#define LEVEL_1_BITS    6
+#define LEVEL_2_BITS    6
+#define LEVEL_0_SLOTS   (1 << LEVEL_0_BITS)
+#define LEVEL_1_SLOTS   (1 << LEVEL_1_BITS)
+#define LEVEL_2_SLOTS   (1 << LEVEL_2_BITS)
+#define TOTAL_SLOTS     (LEVEL_0_SLOTS + LEVEL_1_SLOTS + LEVEL_2_SLOTS)
+
+// Position of the least significant tick bit that selects a slot in each level
+#define LEVEL_1_SHIFT   LEVEL_0_BITS
+#define LEVEL_2_SHIFT   (LEVEL_0_BITS + LEVEL_1_BITS)
+
+// Delays (in ticks) that can be stored directly in each level
+#define LEVEL_0_RANGE   (1UL << LEVEL_1_SHIFT)
+#define LEVEL_1_RANGE   (1UL << LEVEL_2_SHIFT)
+#define LEVEL_2_RANGE   (1UL << (LEVEL_2_SHIFT + LEVEL_2_BITS))
+
+// Index used to terminate the linked lists
+#define NO_TIMER        0xFFFF
+
+// Slot value of a timer that is not in the wheel
+#define NO_SLOT         0xFFFF
+
+// Software timer stored in the static pool
+typedef struct
+{
+	uint16_t next;
+	uint16_t prev;
+	uint16_t slot;
+	uint16_t generation;
+	uint32_t expires;
+	uint32_t period;
+	void (*task)(void);
+} Timer_Wheel_Timer;
+
+// Static pool of software timers
+static Timer_Wheel_Timer timer_pool[TIMER_WHEEL_MAX_TIMERS];
+
+// Head of the linked list for each slot in the three levels
+static uint16_t slot_head[TOTAL_SLOTS];
+
+// Head of the list of unused timers (linked through the next field)
+static uint16_t free_head = NO_TIMER;
+
+// Number of 1 ms ticks processed since initialization
+static volatile uint32_t current_tick = 0;
+
+static void Timer_Wheel_Link(uint16_t index)
+{
+	Timer_Wheel_Timer *timer = &timer_pool[index];
+	uint32_t delta = timer->expires - current_tick;
+	uint16_t slot;
+
+	// Select the lowest level that can hold the remaining delay
+	if (delta < LEVEL_0_RANGE)
+	{
+		slot = timer->expires & (LEVEL_0_SLOTS - 1);
+	}
+	else if (delta < LEVEL_1_RANGE)
+	{
+		slot = LEVEL_0_SLOTS + ((timer->expires >> LEVEL_1_SHIFT) & (LEVEL_1_SLOTS - 1));
+	}
+	else if (delta < LEVEL_2_RANGE)
+	{
+		slot = LEVEL_0_SLOTS + LEVEL_1_SLOTS + ((timer->expires >> LEVEL_2_SHIFT) & (LEVEL_2_SLOTS - 1));
+	}
+	else
+	{
+		// Park the timer in the farthest level 2 slot. It will be cascaded again
+		// and moved closer every time that slot comes up.
+		uint32_t farthest_tick = current_tick + LEVEL_2_RANGE - 1;
+		slot = LEVEL_0_SLOTS + LEVEL_1_SLOTS + ((farthest_tick >> LEVEL_2_SHIFT) & (LEVEL_2_SLOTS - 1));
+	}
+
+	// Insert the timer at the head of the slot's list
+	timer->slot = slot;
+	timer->prev = NO_TIMER;
+	timer->next = slot_head[slot];
+
+	if (timer->next != NO_TIMER)
+	{
+		timer_pool[timer->next].prev = index;
+	}
+
+	slot_head[slot] = index;
+}
+
+static void Timer_Wheel_Unlink(uint16_t index)
+{
+	Timer_Wheel_Timer *timer = &timer_pool[index];
+
+	if (timer->prev != NO_TIMER)
+	{
+		timer_pool[timer->prev].next = timer->next;
+	}
+	else
+	{
+		slot_head[timer->slot] = timer->next;
+	}
+
+	if (timer->next != NO_TIMER)
+	{
+		timer_pool[timer->next].prev = timer->prev;
+	}
+
+	timer->slot = NO_SLOT;
+}
+
+static void Timer_Wheel_Free(uint16_t index)
+{
+	// Invalidate any outstanding handle to this timer
+	timer_pool[index].generation++;
+	timer_pool[index].task = 0;
+
+	timer_pool[index].next = free_head;
+	free_head = index;
+}
+
+static void Timer_Wheel_Cascade(uint16_t slot)
+{
+	// Detach the list from the slot and re-insert each timer.
+	// The remaining delay is now short enough for a lower level.
+	uint16_t index = slot_head[slot];
+	slot_head[slot] = NO_TIMER;
+
+	while (index != NO_TIMER)
+	{
+		uint16_t next = timer_pool[index].next;
+		Timer_Wheel_Link(index);
+		index = next;
+	}
+}
+
+static void Timer_Wheel_Tick(void)
+{
+	// Higher priority interrupts may arm or cancel timers, so the
+	// wheel is only modified with interrupts disabled
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	uint32_t tick = current_tick + 1;
+	current_tick = tick;
+
+	// Cascade the upper levels whenever the lower level wraps around
+	if ((tick & (LEVEL_0_SLOTS - 1)) == 0)
+	{
+		uint32_t level_1_index = (tick >> LEVEL_1_SHIFT) & (LEVEL_1_SLOTS - 1);
+
+		if (level_1_index == 0)
+		{
+			uint32_t level_2_index = (tick >> LEVEL_2_SHIFT) & (LEVEL_2_SLOTS - 1);
+			Timer_Wheel_Cascade(LEVEL_0_SLOTS + LEVEL_1_SLOTS + level_2_index);
+		}
+
+		Timer_Wheel_Cascade(LEVEL_0_SLOTS + level_1_index);
+	}
+
+	// Execute every timer in the current level 0 slot. Timers armed or re-armed
+	// by a task always have a delay of at least 1 tick, so they are never
+	// inserted in the slot that is being processed.
+	uint16_t slot = tick & (LEVEL_0_SLOTS - 1);
+
+	while (slot_head[slot] != NO_TIMER)
+	{
+		uint16_t index = slot_head[slot];
+		Timer_Wheel_Timer *timer = &timer_pool[index];
+		void (*task)(void) = timer->task;
+
+		Timer_Wheel_Unlink(index);
+
+		if (timer->period != 0)
+		{
+			// Re-arm a periodic timer relative to its previous expiration time
+			// so that the period does not drift
+			timer->expires = timer->expires + timer->period;
+			Timer_Wheel_Link(index);
+		}
+		else
+		{
+			Timer_Wheel_Free(index);
+		}
+
+		// Execute the user-defined task with interrupts restored
+		__set_PRIMASK(primask);
+		(*task)();
+		__disable_irq();
+	}
+
+	__set_PRIMASK(primask);
+}
+
+void Timer_Wheel_Init(void)
+{
+	// Empty every slot in the timer wheel
+	for (int i = 0; i < TOTAL_SLOTS; i++)
+	{
+		slot_head[i] = NO_TIMER;
+	}
+
+	// Place every timer in the pool on the free list
+	free_head = NO_TIMER;
+
+	for (int i = TIMER_WHEEL_MAX_TIMERS - 1; i >= 0; i--)
+	{
+		timer_pool[i].slot = NO_SLOT;
+		timer_pool[i].generation = 0;
+		timer_pool[i].task = 0;
+		timer_pool[i].next = free_head;
+		free_head = i;
+	}
+
+	current_tick = 0;
+
+	// Execute the timer wheel tick function every 1 ms
+	Timer_1A_Interrupt_Init(&Timer_Wheel_Tick);
+}
+
+uint32_t Timer_Wheel_Arm(uint32_t delay_ms, uint32_t period_ms, void(*task)(void))
+{
+	uint32_t handle = TIMER_WHEEL_INVALID_HANDLE;
+
+	if (task == 0)
+	{
+		return handle;
+	}
+
+	// A delay of 0 would place the timer in a slot that has already been processed
+	if (delay_ms == 0)
+	{
+		delay_ms = 1;
+	}
+
+	// Prevent TIMER1A_Handler from modifying the wheel while the timer is inserted
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	if (free_head != NO_TIMER)
+	{
+		uint16_t index = free_head;
+		Timer_Wheel_Timer *timer = &timer_pool[index];
+		free_head = timer->next;
+
+		timer->expires = current_tick + delay_ms;
+		timer->period = period_ms;
+		timer->task = task;
+		Timer_Wheel_Link(index);
+
+		handle = ((uint32_t)timer->generation << 16) | index;
+	}
+
+	__set_PRIMASK(primask);
+
+	return handle;
+}
+
+uint8_t Timer_Wheel_Cancel(uint32_t handle)
+{
+	uint16_t index = handle & 0xFFFF;
+	uint16_t generation = handle >> 16;
+	uint8_t cancelled = 0;
+
+	if (index >= TIMER_WHEEL_MAX_TIMERS)
+	{
+		return 0;
+	}
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	// Only cancel the timer if the handle still refers to an armed timer
+	if ((timer_pool[index].generation == generation) && (timer_pool[index].slot != NO_SLOT))
+	{
+		Timer_Wheel_Unlink(index);
+		Timer_Wheel_Free(index);
+		cancelled = 1;
+	}
+
+	__set_PRIMASK(primask);
+
+	return cancelled;
+}
+
+uint32_t Timer_Wheel_Get_Ticks(void)
+{
+	return current_tick;
+}
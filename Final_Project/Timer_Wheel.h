@@ -0,0 +1,96 @@
+/**
+ * @file Timer_Wheel.h
+ *
+ * @brief Header file for the Timer_Wheel driver.
+ *
+ * This file contains the function definitions for the Timer_Wheel driver.
+ * It multiplexes any number of one-shot and periodic software timers onto the
+ * 1 ms periodic interrupt generated by the Timer_1A_Interrupt driver.
+ *
+ * The timers are stored in a hierarchical timer wheel with three levels:
+ *  - Level 0: 256 slots with a resolution of 1 ms    (delays below 256 ms)
+ *  - Level 1:  64 slots with a resolution of 256 ms  (delays below 16.384 s)
+ *  - Level 2:  64 slots with a resolution of 16.384 s (delays below 1048.576 s)
+ *
+ * Each slot holds a doubly-linked list of timers taken from a statically allocated pool,
+ * so arming and cancelling a timer are O(1) operations and no heap memory is used.
+ * Timers in level 1 and level 2 are moved (cascaded) to a lower level when their slot
+ * comes up. Delays longer than the range of level 2 are parked in the farthest
+ * level 2 slot and cascaded again until they are in range.
+ *
+ * @note The user-defined tasks are executed from TIMER1A_Handler, so they must be short
+ * and must not call blocking functions.
+ *
+ * @author Aaron Nanas
+ */
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include "TM4C123GH6PM.h"
+#include "Timer_1A_Interrupt.h"
+
+// Maximum number of timers that can be armed at the same time
+#ifndef TIMER_WHEEL_MAX_TIMERS
+#define TIMER_WHEEL_MAX_TIMERS 256
+#endif
+
+// Value returned by Timer_Wheel_Arm when no timer could be allocated
+#define TIMER_WHEEL_INVALID_HANDLE 0xFFFFFFFF
+
+/**
+ * @brief Initializes the timer wheel and starts the 1 ms Timer 1A interrupt.
+ *
+ * This function places every timer in the static pool on the free list, empties all slots,
+ * and registers the timer wheel tick function as the Timer 1A task.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Timer_Wheel_Init(void);
+
+/**
+ * @brief Arms a one-shot or periodic software timer.
+ *
+ * This function allocates a timer from the static pool and inserts it in the timer wheel.
+ * The task is executed once after delay_ms milliseconds. If period_ms is not zero, the timer
+ * is re-armed automatically and the task is then executed every period_ms milliseconds
+ * until the timer is cancelled.
+ *
+ * This function can be called from the main loop, from any interrupt service routine,
+ * and from a timer wheel task.
+ *
+ * @param delay_ms The delay before the first execution of the task in milliseconds (minimum 1 ms).
+ *
+ * @param period_ms The period of the timer in milliseconds, or 0 for a one-shot timer.
+ *
+ * @param task A pointer to the user-defined function to be executed when the timer expires.
+ *
+ * @return A handle used to cancel the timer, or TIMER_WHEEL_INVALID_HANDLE if the pool is exhausted.
+ */
+uint32_t Timer_Wheel_Arm(uint32_t delay_ms, uint32_t period_ms, void(*task)(void));
+
+/**
+ * @brief Cancels a software timer.
+ *
+ * This function removes the timer from the timer wheel and returns it to the pool.
+ * Cancelling a one-shot timer that has already expired, or a handle that has already been
+ * cancelled, has no effect because each handle contains a generation count.
+ *
+ * @param handle The handle returned by Timer_Wheel_Arm.
+ *
+ * @return 1 if the timer was armed and has been cancelled; Otherwise, 0.
+ */
+uint8_t Timer_Wheel_Cancel(uint32_t handle);
+
+/**
+ * @brief Returns the number of 1 ms ticks processed since Timer_Wheel_Init was called.
+ *
+ * @param None
+ *
+ * @return The current timer wheel tick count in milliseconds.
+ */
+uint32_t Timer_Wheel_Get_Ticks(void);
+
+#endif
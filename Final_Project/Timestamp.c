@@ -0,0 +1,54 @@
+/**
+ * @file Timestamp.c
+ *
+ * @brief Source code for the Timestamp driver.
+ *
+ * This file contains the function definitions for the Timestamp driver.
+ * It uses the Wide Timer 1 module in 64-bit concatenated mode as a free-running,
+ * monotonic up-counter clocked by the system clock.
+ *
+ * @note Wide Timer 0 is not used here because its CCP pin (WT0CCP0) is
+ * shared with the buzzer on PC4.
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz.
+ *
+ * @author Aaron Nanas
+ */
+
+#include "Timestamp.h"
+
+void Timestamp_Init(void)
+{
+	// Set the R1 bit (Bit 1) in the RCGCWTIMER register
+	// to enable the clock for Wide Timer 1
+	SYSCTL->RCGCWTIMER |= 0x02;
+
+	// Wait until Wide Timer 1 is ready to be accessed
+	while ((SYSCTL->PRWTIMER & 0x02) == 0);
+
+	// Clear the TAEN bit (Bit 0) of the GPTMCTL register
+	// to disable Wide Timer 1 during configuration
+	WTIMER1->CTL &= ~0x01;
+
+	// Clear the bits of the GPTMCFG field (Bits 2 to 0) in the GPTMCFG register
+	// 0x0 = Select the 64-bit timer configuration (Timer A and Timer B concatenated)
+	WTIMER1->CFG = 0x00;
+
+	// Set the bits of the TAMR field (Bits 1 to 0) to enable Periodic Timer mode
+	// and set the TACDIR bit (Bit 4) so that the timer counts up from zero
+	// in the GPTMTAMR register
+	WTIMER1->TAMR = 0x12;
+
+	// Use the full 64-bit range by writing the maximum value to
+	// the GPTMTAILR (lower 32 bits) and GPTMTBILR (upper 32 bits) registers
+	WTIMER1->TAILR = 0xFFFFFFFF;
+	WTIMER1->TBILR = 0xFFFFFFFF;
+
+	// Disable all Wide Timer 1 interrupts in the GPTMIMR register
+	WTIMER1->IMR = 0x00;
+
+	// Set the TASTALL bit (Bit 1) in the GPTMCTL register so that the timestamp
+	// stops counting while the processor is halted by the debugger, and set the
+	// TAEN bit (Bit 0) to enable Wide Timer 1
+	WTIMER1->CTL |= 0x03;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file Timestamp.h
+ *
+ * @brief Header file for the Timestamp driver.
+ *
+ * This file contains the function definitions for the Timestamp driver.
+ * It uses the Wide Timer 1 module in 64-bit concatenated mode as a free-running,
+ * monotonic up-counter clocked by the system clock. The counter does not generate
+ * interrupts and does not wrap around for over 11,000 years at 50 MHz.
+ *
+ * The Time_Now_Cycles, Time_Now_us and Time_Now_ms functions can be called
+ * from the main loop or from any interrupt service routine. They only read the
+ * timer registers, so no locking is required.
+ *
+ * @note Time_Now_Cycles reads three timer registers. Time_Now_us and Time_Now_ms
+ * additionally perform a 64-bit division by a constant, so prefer Time_Now_Cycles
+ * and subtract timestamps in cycles when profiling short sections of code.
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz.
+ *
+ * @author Aaron Nanas
+ */
+
+#ifndef TIMESTAMP_H
+#define TIMESTAMP_H
+
+#include "TM4C123GH6PM.h"
+
+// Number of timestamp counter ticks per microsecond and per millisecond (50 MHz system clock)
+#define TIME_CYCLES_PER_US 50
+#define TIME_CYCLES_PER_MS 50000
+
+/**
+ * @brief Initializes the Wide Timer 1 module as a 64-bit free-running timestamp counter.
+ *
+ * This function enables the clock to Wide Timer 1, configures it in the 64-bit
+ * concatenated periodic mode counting up from zero, and starts the timer.
+ * The counter is stalled while the processor is halted by the debugger.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Timestamp_Init(void);
+
+/**
+ * @brief Returns the number of system clock cycles elapsed since Timestamp_Init was called.
+ *
+ * The upper 32 bits (TBV) are read before and after the lower 32 bits (TAV). If the upper half
+ * changed in between, then the lower half has wrapped around and the read is repeated.
+ *
+ * @param None
+ *
+ * @return The 64-bit monotonic timestamp in system clock cycles.
+ */
+static inline uint64_t Time_Now_Cycles(void)
+{
+	uint32_t upper;
+	uint32_t lower;
+
+	do
+	{
+		upper = WTIMER1->TBV;
+		lower = WTIMER1->TAV;
+	} while (upper != WTIMER1->TBV);
+
+	return ((uint64_t)upper << 32) | lower;
+}
+
+/**
+ * @brief Returns the number of microseconds elapsed since Timestamp_Init was called.
+ *
+ * @param None
+ *
+ * @return The 64-bit monotonic timestamp in microseconds.
+ */
+static inline uint64_t Time_Now_us(void)
+{
+	return Time_Now_Cycles() / TIME_CYCLES_PER_US;
+}
+
+/**
+ * @brief Returns the number of milliseconds elapsed since Timestamp_Init was called.
+ *
+ * @param None
+ *
+ * @return The 64-bit monotonic timestamp in milliseconds.
+ */
+static inline uint64_t Time_Now_ms(void)
+{
+	return Time_Now_Cycles() / TIME_CYCLES_PER_MS;
+}
+
+#endif
@@ -0,0 +1,198 @@
+/**
+ * @file Tone.c
+ *
+ * @brief Source code for the Tone driver.
+ *
+ * This file contains the function definitions for the Tone driver.
+ * It uses the Wide Timer 0A module in PWM mode to generate a square wave
+ * on the DMT-1206 Magnetic Buzzer pin (PC4 / WT0CCP0).
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz.
+ *
+ * @author Aaron Nanas
+ */
+
+#include "Tone.h"
+
+// Frequencies of the notes in octave 0 in millihertz (equal temperament, A4 = 440 Hz)
+#define TONE_C0_MHZ     16352
+#define TONE_CS0_MHZ    17324
+#define TONE_D0_MHZ     18354
+#define TONE_DS0_MHZ    19445
+#define TONE_E0_MHZ     20602
+#define TONE_F0_MHZ     21827
+#define TONE_FS0_MHZ    23125
+#define TONE_G0_MHZ     24500
+#define TONE_GS0_MHZ    25957
+#define TONE_A0_MHZ     27500
+#define TONE_AS0_MHZ    29135
+#define TONE_B0_MHZ     30868
+
+// Number of timer clock cycles in one period of a note, rounded to the nearest cycle.
+// The frequency doubles with each octave, so the octave 0 frequency is shifted left by the octave number.
+#define TONE_NOTE_RELOAD(frequency_mhz, octave) \
+	((uint32_t)((((uint64_t)TONE_TIMER_CLOCK_HZ * 1000) + (((uint64_t)(frequency_mhz) << (octave)) / 2)) / ((uint64_t)(frequency_mhz) << (octave))))
+
+// Reload values of the twelve notes of an octave, starting from C
+#define TONE_OCTAVE_RELOADS(octave) \
+	TONE_NOTE_RELOAD(TONE_C0_MHZ, octave),  TONE_NOTE_RELOAD(TONE_CS0_MHZ, octave), \
+	TONE_NOTE_RELOAD(TONE_D0_MHZ, octave),  TONE_NOTE_RELOAD(TONE_DS0_MHZ, octave), \
+	TONE_NOTE_RELOAD(TONE_E0_MHZ, octave),  TONE_NOTE_RELOAD(TONE_F0_MHZ, octave),  \
+	TONE_NOTE_RELOAD(TONE_FS0_MHZ, octave), TONE_NOTE_RELOAD(TONE_G0_MHZ, octave),  \
+	TONE_NOTE_RELOAD(TONE_GS0_MHZ, octave), TONE_NOTE_RELOAD(TONE_A0_MHZ, octave),  \
+	TONE_NOTE_RELOAD(TONE_AS0_MHZ, octave), TONE_NOTE_RELOAD(TONE_B0_MHZ, octave)
+
+// Timer reload values of the notes, starting from TONE_NOTE_LOWEST (computed at compile time)
+static const uint32_t note_reload_values[TONE_NOTE_HIGHEST - TONE_NOTE_LOWEST + 1] =
+{
+	TONE_OCTAVE_RELOADS(0),
+	TONE_OCTAVE_RELOADS(1),
+	TONE_OCTAVE_RELOADS(2),
+	TONE_OCTAVE_RELOADS(3),
+	TONE_OCTAVE_RELOADS(4),
+	TONE_OCTAVE_RELOADS(5),
+	TONE_OCTAVE_RELOADS(6),
+	TONE_OCTAVE_RELOADS(7),
+	TONE_OCTAVE_RELOADS(8)
+};
+
+// Cleared while Wide Timer 0A is used by another driver (see Tone_Disable)
+static volatile uint8_t tone_enabled = 1;
+
+static void Tone_Set_Period(uint32_t period_constant)
+{
+	// Disable Wide Timer 0A while the period is updated
+	WTIMER0->CTL &= ~0x01;
+
+	// Set the period by writing to the
+	// TAILR field (Bits 31 to 0) in the GPTMTAILR register
+	WTIMER0->TAILR = period_constant - 1;
+
+	// Set the duty cycle to 50% by writing half of the period to the
+	// TAMR field (Bits 31 to 0) in the GPTMTAMATCHR register
+	WTIMER0->TAMATCHR = (period_constant / 2) - 1;
+
+	// Connect the PC4 pin to the timer output
+	// by setting Bit 4 in the AFSEL register
+	GPIOC->AFSEL |= 0x10;
+
+	// Set the TAEN bit (Bit 0) in the GPTMCTL register to enable Wide Timer 0A
+	WTIMER0->CTL |= 0x01;
+}
+
+void Tone_Init(void)
+{
+	// Enable the clock to Wide Timer 0 by setting the
+	// R0 bit (Bit 0) in the RCGCWTIMER register
+	SYSCTL->RCGCWTIMER |= 0x01;
+
+	// Enable the clock to GPIO Port C by setting the
+	// R2 bit (Bit 2) in the RCGCGPIO register
+	SYSCTL->RCGCGPIO |= 0x04;
+
+	// Wait until Wide Timer 0 and Port C are ready to be accessed
+	while ((SYSCTL->PRWTIMER & 0x01) == 0);
+	while ((SYSCTL->PRGPIO & 0x04) == 0);
+
+	// Clear the PMC4 field (Bits 19 to 16) in the PCTL register
+	GPIOC->PCTL &= ~0x000F0000;
+
+	// Configure the PC4 pin to operate as a Wide Timer 0A pin (WT0CCP0)
+	// by writing 0x7 to the PMC4 field (Bits 19 to 16) in the PCTL register
+	// The 0x7 value is derived from Table 10-2 in the TM4C123G Microcontroller Datasheet
+	// Note: The alternate function is only selected with the AFSEL register while a tone is playing
+	GPIOC->PCTL |= 0x00070000;
+
+	// Enable the digital functionality for the PC4 pin
+	// by setting Bit 4 in the DEN register
+	GPIOC->DEN |= 0x10;
+
+	// Clear the TAEN bit (Bit 0) of the GPTMCTL register
+	// to disable Wide Timer 0A
+	WTIMER0->CTL &= ~0x01;
+
+	// Set the bits of the GPTMCFG field (Bits 2 to 0) in the GPTMCFG register
+	// 0x4 = Select the 32-bit timer configuration for the wide timer
+	WTIMER0->CFG = 0x04;
+
+	// Set the bits of the TAMR field (Bits 1 to 0) to enable Periodic Timer mode
+	// and set the TAAMS bit (Bit 3) to enable PWM mode in the GPTMTAMR register
+	WTIMER0->TAMR = 0x0A;
+
+	// Clear the TAPWML bit (Bit 6) in the GPTMCTL register
+	// so that the PWM output is not inverted
+	WTIMER0->CTL &= ~0x40;
+}
+
+void Tone_Start(uint32_t frequency)
+{
+	// Leave the timer untouched while it is used by another driver
+	if (tone_enabled == 0)
+	{
+		return;
+	}
+
+	if (frequency == 0)
+	{
+		Tone_Stop();
+		return;
+	}
+
+	// Calculate the number of timer clock cycles in one period of the tone
+	Tone_Set_Period(TONE_TIMER_CLOCK_HZ / frequency);
+}
+
+void Tone_Start_Note(uint8_t note)
+{
+	// Leave the timer untouched while it is used by another driver
+	if (tone_enabled == 0)
+	{
+		return;
+	}
+
+	if ((note < TONE_NOTE_LOWEST) || (note > TONE_NOTE_HIGHEST))
+	{
+		Tone_Stop();
+		return;
+	}
+
+	Tone_Set_Period(note_reload_values[note - TONE_NOTE_LOWEST]);
+}
+
+uint32_t Tone_Get_Note_Period(uint8_t note)
+{
+	if ((note < TONE_NOTE_LOWEST) || (note > TONE_NOTE_HIGHEST))
+	{
+		return 0;
+	}
+
+	return note_reload_values[note - TONE_NOTE_LOWEST];
+}
+
+void Tone_Stop(void)
+{
+	// Leave the timer untouched while it is used by another driver
+	if (tone_enabled == 0)
+	{
+		return;
+	}
+
+	// Clear the TAEN bit (Bit 0) of the GPTMCTL register
+	// to disable Wide Timer 0A
+	WTIMER0->CTL &= ~0x01;
+
+	// Drive the PC4 pin low and return it to GPIO mode
+	// by clearing Bit 4 in the DATA and AFSEL registers
+	GPIO_CLEAR_PINS(GPIOC, 0x10);
+	GPIOC->AFSEL &= ~0x10;
+}
+
+void Tone_Disable(void)
+{
+	tone_enabled = 0;
+}
+
+void Tone_Enable(void)
+{
+	tone_enabled = 1;
+}
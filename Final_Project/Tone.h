@@ -0,0 +1,230 @@
+/**
+ * @file Tone.h
+ *
+ * @brief Header file for the Tone driver.
+ *
+ * This file contains the function definitions for the Tone driver.
+ * It uses the Wide Timer 0A module in PWM mode to generate a square wave
+ * on the DMT-1206 Magnetic Buzzer pin (PC4 / WT0CCP0).
+ *
+ * Once a tone is started, the square wave is generated entirely by the timer,
+ * so no CPU time is spent per cycle and the frequency does not drift with the
+ * interrupt latency of other drivers. While no tone is playing, PC4 is returned
+ * to GPIO mode so that Buzzer_Output can still be used.
+ *
+ * Notes are identified by their MIDI note number (NOTE_C0 - NOTE_B8). The timer reload value
+ * of each note is computed at compile time and stored in flash, so Tone_Start_Note does not
+ * perform any division or floating-point calculation.
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz.
+ *
+ * @author Aaron Nanas
+ */
+
+#ifndef TONE_H
+#define TONE_H
+
+#include "TM4C123GH6PM.h"
+#include "GPIO_Pins.h"
+
+// Frequency of the clock used by Wide Timer 0A (50 MHz system clock)
+#define TONE_TIMER_CLOCK_HZ 50000000
+
+// MIDI note numbers of the notes that can be played by Tone_Start_Note
+enum Tone_Notes
+{
+	NOTE_C0   = 12,
+	NOTE_CS0  = 13,
+	NOTE_D0   = 14,
+	NOTE_DS0  = 15,
+	NOTE_E0   = 16,
+	NOTE_F0   = 17,
+	NOTE_FS0  = 18,
+	NOTE_G0   = 19,
+	NOTE_GS0  = 20,
+	NOTE_A0   = 21,
+	NOTE_AS0  = 22,
+	NOTE_B0   = 23,
+	NOTE_C1   = 24,
+	NOTE_CS1  = 25,
+	NOTE_D1   = 26,
+	NOTE_DS1  = 27,
+	NOTE_E1   = 28,
+	NOTE_F1   = 29,
+	NOTE_FS1  = 30,
+	NOTE_G1   = 31,
+	NOTE_GS1  = 32,
+	NOTE_A1   = 33,
+	NOTE_AS1  = 34,
+	NOTE_B1   = 35,
+	NOTE_C2   = 36,
+	NOTE_CS2  = 37,
+	NOTE_D2   = 38,
+	NOTE_DS2  = 39,
+	NOTE_E2   = 40,
+	NOTE_F2   = 41,
+	NOTE_FS2  = 42,
+	NOTE_G2   = 43,
+	NOTE_GS2  = 44,
+	NOTE_A2   = 45,
+	NOTE_AS2  = 46,
+	NOTE_B2   = 47,
+	NOTE_C3   = 48,
+	NOTE_CS3  = 49,
+	NOTE_D3   = 50,
+	NOTE_DS3  = 51,
+	NOTE_E3   = 52,
+	NOTE_F3   = 53,
+	NOTE_FS3  = 54,
+	NOTE_G3   = 55,
+	NOTE_GS3  = 56,
+	NOTE_A3   = 57,
+	NOTE_AS3  = 58,
+	NOTE_B3   = 59,
+	NOTE_C4   = 60,
+	NOTE_CS4  = 61,
+	NOTE_D4   = 62,
+	NOTE_DS4  = 63,
+	NOTE_E4   = 64,
+	NOTE_F4   = 65,
+	NOTE_FS4  = 66,
+	NOTE_G4   = 67,
+	NOTE_GS4  = 68,
+	NOTE_A4   = 69,
+	NOTE_AS4  = 70,
+	NOTE_B4   = 71,
+	NOTE_C5   = 72,
+	NOTE_CS5  = 73,
+	NOTE_D5   = 74,
+	NOTE_DS5  = 75,
+	NOTE_E5   = 76,
+	NOTE_F5   = 77,
+	NOTE_FS5  = 78,
+	NOTE_G5   = 79,
+	NOTE_GS5  = 80,
+	NOTE_A5   = 81,
+	NOTE_AS5  = 82,
+	NOTE_B5   = 83,
+	NOTE_C6   = 84,
+	NOTE_CS6  = 85,
+	NOTE_D6   = 86,
+	NOTE_DS6  = 87,
+	NOTE_E6   = 88,
+	NOTE_F6   = 89,
+	NOTE_FS6  = 90,
+	NOTE_G6   = 91,
+	NOTE_GS6  = 92,
+	NOTE_A6   = 93,
+	NOTE_AS6  = 94,
+	NOTE_B6   = 95,
+	NOTE_C7   = 96,
+	NOTE_CS7  = 97,
+	NOTE_D7   = 98,
+	NOTE_DS7  = 99,
+	NOTE_E7   = 100,
+	NOTE_F7   = 101,
+	NOTE_FS7  = 102,
+	NOTE_G7   = 103,
+	NOTE_GS7  = 104,
+	NOTE_A7   = 105,
+	NOTE_AS7  = 106,
+	NOTE_B7   = 107,
+	NOTE_C8   = 108,
+	NOTE_CS8  = 109,
+	NOTE_D8   = 110,
+	NOTE_DS8  = 111,
+	NOTE_E8   = 112,
+	NOTE_F8   = 113,
+	NOTE_FS8  = 114,
+	NOTE_G8   = 115,
+	NOTE_GS8  = 116,
+	NOTE_A8   = 117,
+	NOTE_AS8  = 118,
+	NOTE_B8   = 119
+};
+
+// Lowest and highest notes of the note reload table
+#define TONE_NOTE_LOWEST        NOTE_C0
+#define TONE_NOTE_HIGHEST       NOTE_B8
+
+/**
+ * @brief Initializes Wide Timer 0A to generate tones on the PC4 pin.
+ *
+ * This function enables the clock to Wide Timer 0 and Port C, selects WT0CCP0 as the
+ * alternate function of PC4, and configures Timer A in 32-bit periodic PWM mode.
+ * The timer is left disabled and PC4 is left in GPIO mode until Tone_Start is called.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Tone_Init(void);
+
+/**
+ * @brief Starts generating a square wave with a 50% duty cycle on the PC4 pin.
+ *
+ * This function returns immediately. The tone keeps playing until Tone_Stop is called
+ * or until Tone_Start is called with another frequency.
+ *
+ * @param frequency The frequency of the tone in Hz. A frequency of 0 stops the tone.
+ *
+ * @return None
+ */
+void Tone_Start(uint32_t frequency);
+
+/**
+ * @brief Starts playing a note with a 50% duty cycle on the PC4 pin.
+ *
+ * This function loads the precomputed timer reload value of the note and returns immediately.
+ * The note keeps playing until Tone_Stop is called or until another tone is started.
+ *
+ * @param note The MIDI note number of the note (NOTE_C0 - NOTE_B8). A note outside of this range stops the tone.
+ *
+ * @return None
+ */
+void Tone_Start_Note(uint8_t note);
+
+/**
+ * @brief Returns the period of a note in timer clock cycles.
+ *
+ * @param note The MIDI note number of the note (NOTE_C0 - NOTE_B8).
+ *
+ * @return The precomputed number of 50 MHz clock cycles in one period of the note,
+ *         or 0 if the note is out of range.
+ */
+uint32_t Tone_Get_Note_Period(uint8_t note);
+
+/**
+ * @brief Stops the tone that is currently being generated on the PC4 pin.
+ *
+ * This function disables Wide Timer 0A, returns PC4 to GPIO mode and drives it low.
+ * It returns immediately.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Tone_Stop(void);
+
+/**
+ * @brief Gives Wide Timer 0A and the PC4 pin to another driver.
+ *
+ * Tone_Start, Tone_Start_Note and Tone_Stop do nothing until Tone_Enable is called,
+ * so they cannot overwrite the configuration of the timer while it is used by the DDS mixer.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Tone_Disable(void);
+
+/**
+ * @brief Returns Wide Timer 0A and the PC4 pin to the Tone driver after Tone_Disable.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Tone_Enable(void);
+
+#endif
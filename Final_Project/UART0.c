@@ -17,6 +17,42 @@
 
 #include "UART0.h"
 
+// Receive and transmit ring buffers
+// The head and tail indices are free-running, so (tail - head) is the number of characters in a buffer
+static volatile uint8_t rx_buffer[UART0_RX_BUFFER_SIZE];
+static volatile uint16_t rx_head = 0;
+static volatile uint16_t rx_tail = 0;
+
+static volatile uint8_t tx_buffer[UART0_TX_BUFFER_SIZE];
+static volatile uint16_t tx_head = 0;
+static volatile uint16_t tx_tail = 0;
+
+static void UART0_Drain_Receive_FIFO(void)
+{
+	// Move the received characters from the receive FIFO to the receive buffer
+	// The characters are dropped when the receive buffer is full
+	while ((UART0->FR & UART0_RECEIVE_FIFO_EMPTY_BIT_MASK) == 0)
+	{
+		uint8_t character = UART0->DR & 0xFF;
+		
+		if ((uint16_t)(rx_tail - rx_head) < UART0_RX_BUFFER_SIZE)
+		{
+			rx_buffer[rx_tail & (UART0_RX_BUFFER_SIZE - 1)] = character;
+			rx_tail++;
+		}
+	}
+}
+
+static void UART0_Fill_Transmit_FIFO(void)
+{
+	// Move characters from the transmit buffer to the transmit FIFO until it is full
+	while ((tx_head != tx_tail) && ((UART0->FR & UART0_TRANSMIT_FIFO_FULL_BIT_MASK) == 0))
+	{
+		UART0->DR = tx_buffer[tx_head & (UART0_TX_BUFFER_SIZE - 1)];
+		tx_head++;
+	}
+}
+
 void UART0_Init(void)
 {
 	// Enable the clock to UART0 by setting the 
@@ -79,19 +115,170 @@ void UART0_Init(void)
 	// Enable the digital functionality for the PA1 and PA0 pins
 	// by setting Bits 1 to 0 in the DEN register
 	GPIOA->DEN |= 0x03;
+	
+	rx_head = 0;
+	rx_tail = 0;
+	tx_head = 0;
+	tx_tail = 0;
+	
+	// Select the FIFO levels that trigger the interrupts in the IFLS register
+	// RXIFLSEL (Bits 5 to 3) = 0x2: Receive interrupt when the receive FIFO is 1/2 full (8 characters)
+	// TXIFLSEL (Bits 2 to 0) = 0x1: Transmit interrupt when the transmit FIFO drops to 1/4 full (4 characters)
+	UART0->IFLS = (0x2 << 3) | 0x1;
+	
+	// Clear the receive, transmit, and receive timeout interrupts by setting
+	// the RXIC (Bit 4), TXIC (Bit 5), and RTIC (Bit 6) bits in the ICR register
+	UART0->ICR = 0x70;
+	
+	// Enable the receive (RXIM, Bit 4), transmit (TXIM, Bit 5), and receive timeout (RTIM, Bit 6)
+	// interrupts in the IM register. The receive timeout interrupt is triggered when the receive FIFO
+	// holds fewer characters than the trigger level and no character has arrived for 32 bit periods
+	UART0->IM |= 0x70;
+	
+	// Set the priority level to 2 for the UART0 interrupt
+	// UART0 has an IRQ of 5
+	NVIC->IP[5] = (2 << 5);
+	
+	// Enable IRQ 5 for UART0 by setting Bit 5 in the ISER[0] register
+	NVIC->ISER[0] |= (1 << 5);
+}
+
+void UART0_Set_Baud_Rate(uint32_t baud_rate)
+{
+	// Wait until the characters in the transmit buffer and the transmit FIFO have been sent
+	// by checking the BUSY bit (Bit 3) in the FR register
+	while ((tx_head != tx_tail) || (UART0->FR & UART0_BUSY_BIT_MASK));
+	
+	// Disable the UART0 module before changing the baud rate by clearing
+	// the UARTEN bit (Bit 0) in the CTL register
+	UART0->CTL &= ~0x01;
+	
+	// Divide the UART clock by 8 instead of 16 for the baud rates above 3.125 Mbps
+	// by setting the HSE bit (Bit 5) in the CTL register
+	uint32_t clock_divider = 16;
+	
+	if (baud_rate > (UART0_CLOCK_FREQUENCY / 16))
+	{
+		UART0->CTL |= 0x20;
+		clock_divider = 8;
+	}
+	else
+	{
+		UART0->CTL &= ~0x20;
+	}
+	
+	// Calculate the baud rate divisor in units of 1/64, rounded to the nearest unit
+	// Divisor = (System Clock Frequency) / (clock_divider * Baud Rate)
+	uint32_t divisor = ((UART0_CLOCK_FREQUENCY * (64 / clock_divider)) + (baud_rate / 2)) / baud_rate;
+	
+	// Write the integer part of the divisor to the DIVINT field (Bits 15 to 0) in the IBRD register
+	// and the fractional part to the DIVFRAC field (Bits 5 to 0) in the FBRD register
+	UART0->IBRD = divisor >> 6;
+	UART0->FBRD = divisor & 0x3F;
+	
+	// The new divisor only takes effect after the LCRH register has been written
+	UART0->LCRH = UART0->LCRH;
+	
+	// Enable the UART0 module by setting the UARTEN bit (Bit 0) in the CTL register
+	UART0->CTL |= 0x01;
+}
+
+uint32_t UART0_Write(const char *data, uint32_t length)
+{
+	uint32_t accepted = 0;
+	
+	while (accepted < length)
+	{
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		
+		// Stop once the transmit buffer is full
+		if ((uint16_t)(tx_tail - tx_head) >= UART0_TX_BUFFER_SIZE)
+		{
+			__set_PRIMASK(primask);
+			break;
+		}
+		
+		tx_buffer[tx_tail & (UART0_TX_BUFFER_SIZE - 1)] = data[accepted];
+		tx_tail++;
+		accepted++;
+		
+		__set_PRIMASK(primask);
+	}
+	
+	// Start the transmission by filling the transmit FIFO. The transmit interrupt
+	// then refills it each time it drops to the trigger level
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	
+	UART0_Fill_Transmit_FIFO();
+	
+	__set_PRIMASK(primask);
+	
+	return accepted;
+}
+
+uint32_t UART0_Read(char *data, uint32_t length)
+{
+	uint32_t count = 0;
+	
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	
+	// Collect the characters that are still in the receive FIFO, in case
+	// the UART0 interrupt cannot preempt the caller
+	UART0_Drain_Receive_FIFO();
+	
+	__set_PRIMASK(primask);
+	
+	while (count < length)
+	{
+		primask = __get_PRIMASK();
+		__disable_irq();
+		
+		// Stop once the receive buffer is empty
+		if (rx_head == rx_tail)
+		{
+			__set_PRIMASK(primask);
+			break;
+		}
+		
+		data[count] = rx_buffer[rx_head & (UART0_RX_BUFFER_SIZE - 1)];
+		rx_head++;
+		count++;
+		
+		__set_PRIMASK(primask);
+	}
+	
+	return count;
+}
+
+uint32_t UART0_Get_Available(void)
+{
+	return (uint16_t)(rx_tail - rx_head);
+}
+
+uint32_t UART0_Get_Free_Space(void)
+{
+	return UART0_TX_BUFFER_SIZE - (uint16_t)(tx_tail - tx_head);
 }
 
 char UART0_Input_Character(void)
 {
-	while((UART0->FR & UART0_RECEIVE_FIFO_EMPTY_BIT_MASK) != 0);
+	char character;
 	
-	return (char)(UART0->DR & 0xFF);
+	// Wait until a character is available in the receive buffer
+	while (UART0_Read(&character, 1) == 0);
+	
+	return character;
 }
 
 void UART0_Output_Character(char data)
 {
-	while((UART0->FR & UART0_TRANSMIT_FIFO_FULL_BIT_MASK) != 0);
-	UART0->DR = data;
+	// Wait until there is room in the transmit buffer
+	// Each attempt also moves characters to the transmit FIFO, so this function
+	// does not wait forever when it is called from a higher-priority interrupt
+	while (UART0_Write(&data, 1) == 0);
 }
 
 void UART0_Input_String(char *buffer_pointer, uint16_t buffer_size) 
@@ -167,16 +354,9 @@ uint32_t UART0_Input_Unsigned_Decimal(void)
 
 void UART0_Output_Unsigned_Decimal(uint32_t n)
 {
-	// Use recursion to convert decimal number
-	// of unspecified length as an ASCII string
-  if (n >= 10)
-	{
-    UART0_Output_Unsigned_Decimal(n / 10);
-    n = n % 10;
-  }
-	
-	// n is between 0 and 9
-  UART0_Output_Character(n + '0');
+	char buffer[FORMAT_BUFFER_SIZE];
+	Format_Unsigned_Decimal(buffer, n);
+	UART0_Output_String(buffer);
 }
 
 uint32_t UART0_Input_Unsigned_Hexadecimal(void)
@@ -227,24 +407,9 @@ uint32_t UART0_Input_Unsigned_Hexadecimal(void)
 
 void UART0_Output_Unsigned_Hexadecimal(uint32_t number)
 {
-	// Use recursion to convert the number of
-	// unspecified length as an ASCII string
-	if (number >= 0x10)
-	{
-		UART0_Output_Unsigned_Hexadecimal(number / 0x10);
-		UART0_Output_Unsigned_Hexadecimal(number % 0x10);
-	}
-	else
-	{
-		if (number < 0xA)
-		{
-			UART0_Output_Character(number + '0');
-		}
-		else
-		{
-			UART0_Output_Character((number - 0x0A) + 'A');
-		}
-	}
+	char buffer[FORMAT_BUFFER_SIZE];
+	Format_Hexadecimal(buffer, number, 0);
+	UART0_Output_String(buffer);
 }
 
 void UART0_Output_Newline(void)
@@ -252,3 +417,15 @@ void UART0_Output_Newline(void)
 	UART0_Output_Character(UART0_CR);
 	UART0_Output_Character(UART0_LF);
 }
+
+void UART0_Handler(void)
+{
+	// Acknowledge the receive, transmit, and receive timeout interrupts by setting
+	// the RXIC (Bit 4), TXIC (Bit 5), and RTIC (Bit 6) bits in the ICR register
+	UART0->ICR = UART0->MIS & 0x70;
+	
+	// Empty the receive FIFO after a receive or receive timeout interrupt,
+	// and refill the transmit FIFO after a transmit interrupt
+	UART0_Drain_Receive_FIFO();
+	UART0_Fill_Transmit_FIFO();
+}
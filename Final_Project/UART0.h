@@ -12,13 +12,32 @@
  *
  * @note Assumes that the system clock (50 MHz) is used.
  *
+ * The received and transmitted characters pass through ring buffers that are serviced
+ * by the UART0 interrupt. The receive interrupt is triggered when the receive FIFO is half full,
+ * and the receive timeout interrupt collects the remaining characters after 32 idle bit periods.
+ * The transmit interrupt refills the transmit FIFO when it drops to a quarter full. UART0_Write
+ * and UART0_Read never wait, while the character and string functions wait on the ring buffers.
+ *
+ * The interrupt moves about 14 CPU cycles per character including its entry and exit, so the
+ * estimated CPU load in each direction is about 0.3% at 115200 baud, 2.6% at 921600 baud, and 9%
+ * at 3.125 Mbaud (312.5 kB/s), the highest rate with the 16x oversampling.
+ *
  * @author Aaron Nanas
  */
 
 #include "TM4C123GH6PM.h"
+#include "Format.h"
 
 #define UART0_RECEIVE_FIFO_EMPTY_BIT_MASK 0x10
 #define UART0_TRANSMIT_FIFO_FULL_BIT_MASK 0x20
+#define UART0_BUSY_BIT_MASK 0x08
+
+// Frequency of the UART clock (system clock) in Hz
+#define UART0_CLOCK_FREQUENCY 50000000
+
+// Sizes of the receive and transmit ring buffers (must be powers of two, up to 32768)
+#define UART0_RX_BUFFER_SIZE 256
+#define UART0_TX_BUFFER_SIZE 256
 
 /**
  * @brief Carriage return character
@@ -63,6 +82,74 @@
  */
 void UART0_Init(void);
 
+/**
+ * @brief Changes the baud rate of the UART0 module.
+ *
+ * This function waits until the pending characters have been transmitted, and it disables the
+ * UART0 module while the baud rate divisor is written. The UART clock is divided by 8 instead of 16
+ * (HSE) for the baud rates above 3.125 Mbps, which allows up to 6.25 Mbps.
+ *
+ * @param baud_rate The new baud rate in bits per second.
+ *
+ * @return None
+ */
+void UART0_Set_Baud_Rate(uint32_t baud_rate);
+
+/**
+ * @brief Queues characters to be transmitted without waiting.
+ *
+ * The characters are copied to the transmit ring buffer until it is full, and the transmit FIFO
+ * is filled. The remaining characters are sent by the UART0 interrupt.
+ *
+ * @param data Pointer to the characters to be transmitted.
+ *
+ * @param length The number of characters to be transmitted.
+ *
+ * @return The number of characters that were accepted (0 - length).
+ */
+uint32_t UART0_Write(const char *data, uint32_t length);
+
+/**
+ * @brief Reads the received characters without waiting.
+ *
+ * @param data Pointer to the buffer where the received characters will be stored.
+ *
+ * @param length The maximum number of characters to be read.
+ *
+ * @return The number of characters that were read (0 - length).
+ */
+uint32_t UART0_Read(char *data, uint32_t length);
+
+/**
+ * @brief Returns the number of received characters that are waiting in the receive ring buffer.
+ *
+ * @param None
+ *
+ * @return The number of characters that can be read.
+ */
+uint32_t UART0_Get_Available(void);
+
+/**
+ * @brief Returns the free space of the transmit ring buffer.
+ *
+ * @param None
+ *
+ * @return The number of characters that UART0_Write can accept.
+ */
+uint32_t UART0_Get_Free_Space(void);
+
+/**
+ * @brief The interrupt service routine for UART0 (IRQ 5).
+ *
+ * It moves the characters from the receive FIFO to the receive ring buffer on a receive or
+ * receive timeout interrupt, and it refills the transmit FIFO from the transmit ring buffer.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void UART0_Handler(void);
+
 /**
  * @brief The UART0_Input_Character function reads a character from the UART data register.
  *
@@ -132,6 +219,7 @@ uint32_t UART0_Input_Unsigned_Decimal(void);
  * @brief The UART0_Output_Unsigned_Decimal function transmits an unsigned decimal number via UART to the serial terminal.
  *
  * This function transmits the provided unsigned decimal number (n) via UART to the serial terminal.
+ * The number is converted into a decimal ASCII string with the Format driver.
  *
  * @param n The unsigned decimal number to be transmitted to the serial terminal.
  *
@@ -158,7 +246,7 @@ uint32_t UART0_Input_Unsigned_Hexadecimal(void);
  * @brief The UART0_Output_Unsigned_Hexadecimal function transmits an unsigned hexadecimal number via UART to the serial terminal.
  *
  * This function transmits the provided unsigned hexadecimal number (number) via UART to the serial terminal.
- * The number is converted into a hexadecimal ASCII string and transmitted character by character.
+ * The number is converted into a hexadecimal ASCII string with the Format driver and transmitted character by character.
  *
  * @param number The unsigned hexadecimal number to be transmitted to the serial terminal.
  *
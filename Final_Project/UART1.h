@@ -12,6 +12,16 @@
  *
  * @note Assumes that the system clock (50 MHz) is used.
  *
+ * The received and transmitted characters pass through ring buffers that are serviced
+ * by the UART1 interrupt. The receive interrupt is triggered when the receive FIFO is half full,
+ * and the receive timeout interrupt collects the remaining characters after 32 idle bit periods.
+ * The transmit interrupt refills the transmit FIFO when it drops to a quarter full. UART1_Write
+ * and UART1_Read never wait, while the character and string functions wait on the ring buffers.
+ *
+ * The interrupt moves about 14 CPU cycles per character including its entry and exit, so the
+ * estimated CPU load in each direction is about 0.3% at 115200 baud, 2.6% at 921600 baud, and 9%
+ * at 3.125 Mbaud (312.5 kB/s), the highest rate with the 16x oversampling.
+ *
  * @author Aaron Nanas
  */
 
@@ -19,6 +29,14 @@
 
 #define UART1_RECEIVE_FIFO_EMPTY_BIT_MASK 0x10
 #define UART1_TRANSMIT_FIFO_FULL_BIT_MASK 0x20
+#define UART1_BUSY_BIT_MASK 0x08
+
+// Frequency of the UART clock (system clock) in Hz
+#define UART1_CLOCK_FREQUENCY 50000000
+
+// Sizes of the receive and transmit ring buffers (must be powers of two, up to 32768)
+#define UART1_RX_BUFFER_SIZE 256
+#define UART1_TX_BUFFER_SIZE 256
 
 /**
  * @brief Carriage return character
@@ -63,6 +81,74 @@
  */
 void UART1_Init(void);
 
+/**
+ * @brief Changes the baud rate of the UART1 module.
+ *
+ * This function waits until the pending characters have been transmitted, and it disables the
+ * UART1 module while the baud rate divisor is written. The UART clock is divided by 8 instead of 16
+ * (HSE) for the baud rates above 3.125 Mbps, which allows up to 6.25 Mbps.
+ *
+ * @param baud_rate The new baud rate in bits per second.
+ *
+ * @return None
+ */
+void UART1_Set_Baud_Rate(uint32_t baud_rate);
+
+/**
+ * @brief Queues characters to be transmitted without waiting.
+ *
+ * The characters are copied to the transmit ring buffer until it is full, and the transmit FIFO
+ * is filled. The remaining characters are sent by the UART1 interrupt.
+ *
+ * @param data Pointer to the characters to be transmitted.
+ *
+ * @param length The number of characters to be transmitted.
+ *
+ * @return The number of characters that were accepted (0 - length).
+ */
+uint32_t UART1_Write(const char *data, uint32_t length);
+
+/**
+ * @brief Reads the received characters without waiting.
+ *
+ * @param data Pointer to the buffer where the received characters will be stored.
+ *
+ * @param length The maximum number of characters to be read.
+ *
+ * @return The number of characters that were read (0 - length).
+ */
+uint32_t UART1_Read(char *data, uint32_t length);
+
+/**
+ * @brief Returns the number of received characters that are waiting in the receive ring buffer.
+ *
+ * @param None
+ *
+ * @return The number of characters that can be read.
+ */
+uint32_t UART1_Get_Available(void);
+
+/**
+ * @brief Returns the free space of the transmit ring buffer.
+ *
+ * @param None
+ *
+ * @return The number of characters that UART1_Write can accept.
+ */
+uint32_t UART1_Get_Free_Space(void);
+
+/**
+ * @brief The interrupt service routine for UART1 (IRQ 6).
+ *
+ * It moves the characters from the receive FIFO to the receive ring buffer on a receive or
+ * receive timeout interrupt, and it refills the transmit FIFO from the transmit ring buffer.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void UART1_Handler(void);
+
 /**
  * @brief The UART1_Input_Character function reads a character from the UART data register.
  *
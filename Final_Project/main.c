@@ -3,42 +3,305 @@
  *
  * @brief Main source code for the Final Project program.
  *
+ * The applications are executed as tasks by the cooperative scheduler.
+ * The EduBase buttons are sampled by a periodic timer wheel task, and each
+ * debounced button press is posted as an event to the application in the foreground.
+ *
+ * Each application draws on its own virtual LCD screen, so the applications in the
+ * background keep updating their screens without accessing the LCD. Pressing the
+ * user switch SW1 of the LaunchPad brings the next application to the foreground
+ * and displays its screen. The LCD is only accessed by the tasks, so the button
+ * scan posts the switch as an event instead of displaying the screen itself.
+ *
  * @author Aaron Nanas
  */
- 
+
 #include "TM4C123GH6PM.h"
 #include "stdlib.h"
 #include "string.h"
 #include "SysTick_Delay.h"
+#include "Timestamp.h"
+#include "Timer_Wheel.h"
+#include "Scheduler.h"
 #include "GPIO.h"
 #include "Buzzer.h"
+#include "Music_Player.h"
+#include "DDS_Mixer.h"
+#include "UART0.h"
+#include "Song_Stream.h"
 #include "EduBase_LCD.h"
+#include "EduBase_LCD_Animation.h"
+#include "EduBase_LCD_Bar_Graph.h"
+#include "EduBase_LCD_Big_Digits.h"
+#include "Analog_Sensors.h"
+#include "Seven_Segment_Display.h"
+#include "Sequence_Game.h"
+
+// Priority levels of the tasks executed by the scheduler
+// The animation task must have a higher priority than the tasks that start animations
+#define LCD_ANIMATION_TASK_PRIORITY      0
+#define APPLICATION_SWITCH_TASK_PRIORITY 1
+#define SONG_SELECT_TASK_PRIORITY        2
+#define LCD_CONTROLLER_TASK_PRIORITY     3
+#define SEQUENCE_GAME_TASK_PRIORITY      4
+#define SENSOR_MONITOR_TASK_PRIORITY     5
+
+// Virtual LCD screens of the applications, in the order in which SW1 switches between them
+#define SONG_SELECT_SCREEN              0
+#define LCD_CONTROLLER_SCREEN           1
+#define SENSOR_MONITOR_SCREEN           2
+#define SEQUENCE_GAME_SCREEN            3
+#define APPLICATION_COUNT               4
+
+// Bit of the sampled button status that holds the LaunchPad switch SW1
+#define APPLICATION_SWITCH_BUTTON       0x10
+
+// Length of the LED sequence used by the Sequence Game
+#define SEQUENCE_GAME_LENGTH            4
+
+// Interval between two samples of the EduBase buttons in milliseconds
+#define BUTTON_SCAN_INTERVAL_MS         10
+
+// Interval between two samples of the analog sensors displayed by the Sensor Monitor in milliseconds
+#define SENSOR_MONITOR_INTERVAL_MS      10
+
+// Views of the Sensor Monitor, selected with the EduBase buttons
+#define SENSOR_MONITOR_VIEW_BARS        0
+#define SENSOR_MONITOR_VIEW_DIGITS      1
+
+// Event posted to the Song Select task when a song has finished playing
+#define SONG_SELECT_EVENT_SONG_FINISHED 0x100
+
+// Priority of the task of each application, indexed by the screen of the application
+static const uint8_t application_priorities[APPLICATION_COUNT] =
+{
+	SONG_SELECT_TASK_PRIORITY,
+	LCD_CONTROLLER_TASK_PRIORITY,
+	SENSOR_MONITOR_TASK_PRIORITY,
+	SEQUENCE_GAME_TASK_PRIORITY
+};
+
+// Application in the foreground, which receives the EduBase button events
+static uint8_t foreground_application = SONG_SELECT_SCREEN;
+
+// View displayed by the Sensor Monitor
+static uint8_t sensor_monitor_view = SENSOR_MONITOR_VIEW_BARS;
+
+// Previous sample and debounced status of the EduBase buttons and SW1
+static uint8_t last_button_sample = 0;
+static uint8_t debounced_button_status = 0;
+
+void Application_Switch_Task(uint32_t events)
+{
+	(void)events;
+
+	// Pause the Sequence Game when it leaves the foreground, so that it does not blink the LEDs
+	// or wait for button presses that are sent to another application
+	if (foreground_application == SEQUENCE_GAME_SCREEN)
+	{
+		Sequence_Game_Pause();
+	}
+
+	foreground_application = (foreground_application + 1) % APPLICATION_COUNT;
+
+	// Only the cells that differ between the two screens are transmitted
+	EduBase_LCD_Buffer_Show_Screen(foreground_application);
+
+	// Resume the interrupted round when the Sequence Game is brought back to the foreground,
+	// or start a new round if there is none
+	if (foreground_application == SEQUENCE_GAME_SCREEN)
+	{
+		if (!Sequence_Game_Resume())
+		{
+			Sequence_Game_Start(SEQUENCE_GAME_LENGTH);
+		}
+	}
+}
+
+void Button_Scan(void)
+{
+	uint8_t button_sample = Get_EduBase_Button_Status() | (Get_LaunchPad_Button_Status() << 4);
+
+	// Accept a new button status only when two consecutive samples match
+	if ((button_sample == last_button_sample) && (button_sample != debounced_button_status))
+	{
+		// Post the buttons that have just been pressed to the main application
+		uint8_t buttons_pressed = button_sample & ~debounced_button_status;
+		debounced_button_status = button_sample;
+
+		// The screen is switched by a task, since the LCD must not be accessed from an interrupt
+		if (buttons_pressed & APPLICATION_SWITCH_BUTTON)
+		{
+			Scheduler_Post(APPLICATION_SWITCH_TASK_PRIORITY, APPLICATION_SWITCH_BUTTON);
+		}
+
+		if (buttons_pressed & 0x0F)
+		{
+			Scheduler_Post(application_priorities[foreground_application], buttons_pressed & 0x0F);
+		}
+	}
+
+	last_button_sample = button_sample;
+}
+
+void Song_Finished(void)
+{
+	Scheduler_Post(SONG_SELECT_TASK_PRIORITY, SONG_SELECT_EVENT_SONG_FINISHED);
+}
+
+void Song_Select_Task(uint32_t events)
+{
+	uint8_t button_status = events & 0x0F;
+
+	EduBase_LCD_Buffer_Select_Screen(SONG_SELECT_SCREEN);
+
+	// Start the song selected by the button press in the background
+	// The music player is left to the song stream while a song is being received through UART0
+	if (button_status != 0)
+	{
+		if (Song_Stream_Is_Receiving())
+		{
+			EduBase_LCD_Print_Text("Receiving song", "Please wait");
+		}
+		else
+		{
+			Song_Select(button_status);
+		}
+	}
+
+	// Display the prompt at startup and once the song has finished
+	else
+	{
+		Song_Select(0x00);
+	}
+}
 
+void EduBase_LCD_Controller_Task(uint32_t events)
+{
+	uint8_t button_status = events & 0x0F;
+
+	EduBase_LCD_Buffer_Select_Screen(LCD_CONTROLLER_SCREEN);
+
+	if (button_status != 0)
+	{
+		EduBase_LCD_Controller(button_status);
+	}
+
+	// Display the prompt at startup
+	else
+	{
+		EduBase_LCD_Print_Text("LCD Controller", "Press a button");
+	}
+}
+
+void Sensor_Monitor_Task(uint32_t events)
+{
+	uint8_t button_status = events & 0x0F;
+	uint16_t sensor_samples[2];
+
+	Sample_Analog_Sensors_Raw(sensor_samples);
+
+	// The screen is updated in RAM while the Sensor Monitor is in the background
+	EduBase_LCD_Buffer_Select_Screen(SENSOR_MONITOR_SCREEN);
+
+	// Switch between the bar graphs and the large digits when a button is pressed
+	if (button_status != 0)
+	{
+		sensor_monitor_view = (sensor_monitor_view == SENSOR_MONITOR_VIEW_BARS) ? SENSOR_MONITOR_VIEW_DIGITS : SENSOR_MONITOR_VIEW_BARS;
+		EduBase_LCD_Buffer_Clear();
+	}
+
+	if (sensor_monitor_view == SENSOR_MONITOR_VIEW_BARS)
+	{
+		// Display the potentiometer on the top row and the light sensor on the bottom row
+		// The labels are only transmitted once, and each update transmits the cells at the tip of the bars
+		EduBase_LCD_Buffer_Write_Character(0, 0, 'P');
+		EduBase_LCD_Buffer_Write_Character(0, 1, 'L');
+		EduBase_LCD_Bar_Graph_Write(1, 0, EDUBASE_LCD_COLUMNS - 1, sensor_samples[0], ANALOG_SENSORS_FULL_SCALE);
+		EduBase_LCD_Bar_Graph_Write(1, 1, EDUBASE_LCD_COLUMNS - 1, sensor_samples[1], ANALOG_SENSORS_FULL_SCALE);
+		EduBase_LCD_Buffer_Flush();
+	}
+	else
+	{
+		// Display the potentiometer reading (0 - 4095) with four large digits in columns 0 to 14
+		// The label is written to the last column, and the display is flushed with the digits,
+		// so each update only transmits the digits that have changed
+		EduBase_LCD_Buffer_Write_Character(EDUBASE_LCD_COLUMNS - 1, 0, 'P');
+		EduBase_LCD_Big_Digits_Display(sensor_samples[0], 0, BIG_DIGIT_MAX_DIGITS);
+	}
+
+	// Display the potentiometer reading on the seven-segment display, which is refreshed in the background
+	Seven_Segment_Set_Value(sensor_samples[0]);
+
+	// Dim the seven-segment display in a dark environment
+	Seven_Segment_Auto_Brightness(sensor_samples[1]);
+
+	// Sample the sensors again after the interval
+	Scheduler_Set_Timeout(SENSOR_MONITOR_TASK_PRIORITY, SENSOR_MONITOR_INTERVAL_MS);
+}
 
 int main(void)
-{		
-	// Initialize the SysTick timer used to provide blocking delay functions
+{
+	// Initialize the DWT cycle counter used to provide blocking delay functions
 	SysTick_Delay_Init();
-	
+
+	// Initialize the 64-bit monotonic timestamp counter (Wide Timer 1)
+	Timestamp_Init();
+
+	// Initialize the software timer wheel driven by the 1 ms Timer 1A interrupt
+	Timer_Wheel_Init();
+
+	// Initialize the cooperative scheduler
+	Scheduler_Init();
+
 	// Initialize the Magnetic Buzzer (Port C)
 	Buzzer_Init();
-	
+
+	// Initialize the Timer 2A sample interrupt of the DDS mixer, and let the mixer drive the buzzer
+	// The songs and the sound effects are played on separate voices and mixed together
+	DDS_Mixer_Init();
+	DDS_Mixer_Start();
+
+	// Initialize the background music player
+	Music_Player_Init(&Song_Finished);
+
+	// Initialize UART0 and play the songs that are received through it
+	UART0_Init();
+	Song_Stream_Init();
+
 	// Initialize the 16x2 LCD on the EduBase board
 	EduBase_LCD_Init();
-	
+
+	// Initialize the potentiometer and the analog light sensor on the EduBase board (ADC0)
+	Analog_Sensors_Init();
+
+	// Initialize the seven-segment display on the EduBase board (SSI2), refreshed by Timer 4A
+	Seven_Segment_Display_Init();
+
 	// Initialize the buttons (SW2 - SW5) on the EduBase board (Port D)
 	EduBase_Button_Init();
-	
-	while(1)
-	{
-		uint8_t button_status = Get_EduBase_Button_Status();
-		Song_Select(button_status);
-	}
-	
 
-	while(1)
-	{
-		uint8_t button_status = Get_EduBase_Button_Status();
-		EduBase_LCD_Controller(button_status);
-	}
+	// Initialize the user switch SW1 on the LaunchPad (PF4), which switches between the applications
+	LaunchPad_Button_Init();
+
+	// Register the application tasks with the scheduler
+	EduBase_LCD_Animation_Init(LCD_ANIMATION_TASK_PRIORITY);
+	Scheduler_Add_Task(APPLICATION_SWITCH_TASK_PRIORITY, &Application_Switch_Task);
+	Scheduler_Add_Task(SONG_SELECT_TASK_PRIORITY, &Song_Select_Task);
+	Scheduler_Add_Task(LCD_CONTROLLER_TASK_PRIORITY, &EduBase_LCD_Controller_Task);
+	Sequence_Game_Init(SEQUENCE_GAME_TASK_PRIORITY);
+	Scheduler_Add_Task(SENSOR_MONITOR_TASK_PRIORITY, &Sensor_Monitor_Task);
+
+	// Sample the buttons periodically
+	Timer_Wheel_Arm(BUTTON_SCAN_INTERVAL_MS, BUTTON_SCAN_INTERVAL_MS, &Button_Scan);
+
+	// Draw the screen of each application, and start sampling the analog sensors in the background
+	EduBase_LCD_Buffer_Select_Screen(SEQUENCE_GAME_SCREEN);
+	EduBase_LCD_Buffer_Print_Text("Sequence Game", "Repeat the LEDs");
+	Scheduler_Post(SONG_SELECT_TASK_PRIORITY, 0);
+	Scheduler_Post(LCD_CONTROLLER_TASK_PRIORITY, 0);
+	Scheduler_Post(SENSOR_MONITOR_TASK_PRIORITY, 0);
+
+	// Execute the ready tasks and sleep when there is nothing to do
+	Scheduler_Run();
 }